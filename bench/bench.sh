@@ -0,0 +1,104 @@
+#!/bin/bash
+# Throughput benchmark for the uint input/output and sort support functions
+#
+# Times COPY TO/FROM in text and binary format, a full sort and an index
+# build over a single-column table of each width, and prints rows/s and
+# ns/value for each step.  The binary COPY is also timed over eight columns
+# of the type ("x8"), whose figures are per row of eight values.
+#
+# Needs a running server with the extension installed ("make install").  The
+# usual libpq environment variables (PGHOST, PGDATABASE, ...) pick the
+# database; BENCH_ROWS sets the table size (default 10000000) and
+# BENCH_TYPES the types to run (default "uint2 uint4 uint8").
+
+ROWS=${BENCH_ROWS:-10000000}
+TYPES=${BENCH_TYPES:-"uint2 uint4 uint8"}
+PSQL="psql -X -q -v ON_ERROR_STOP=1"
+DATAFILE=${TMPDIR:-/tmp}/uints_bench.$$
+
+trap 'rm -f $DATAFILE.txt $DATAFILE.bin' EXIT
+
+now()
+{
+	date +%s%N
+}
+
+# run NAME COMMAND...: time COMMAND over $ROWS rows and report throughput
+run()
+{
+	local name=$1
+	local start
+	local ns
+
+	shift
+	start=$(now)
+	"$@" || exit 1
+	ns=$(( $(now) - start ))
+
+	awk -v name="$name" -v rows=$ROWS -v ns=$ns 'BEGIN {
+		printf "%-24s %14.0f rows/s %10.1f ns/value\n",
+			name, rows / (ns / 1e9), ns / rows
+	}'
+}
+
+max_value()
+{
+	case $1 in
+		uint2) echo 65535 ;;
+		uint4) echo 4294967295 ;;
+		uint8) echo 18446744073709551615 ;;
+	esac
+}
+
+$PSQL -c "CREATE EXTENSION IF NOT EXISTS uints" || exit 1
+
+for t in $TYPES
+do
+	table=bench_$t
+
+	echo "$t, $ROWS rows"
+
+	$PSQL <<EOF || exit 1
+DROP TABLE IF EXISTS $table;
+CREATE UNLOGGED TABLE $table (v $t);
+INSERT INTO $table
+    SELECT (random() * $(max_value $t)::float8)::uint8::$t
+    FROM generate_series(1, $ROWS);
+VACUUM ANALYZE $table;
+EOF
+
+	run "  COPY TO text" \
+		$PSQL -c "COPY $table TO STDOUT" -o $DATAFILE.txt
+	run "  COPY TO binary" \
+		$PSQL -c "COPY $table TO STDOUT (FORMAT binary)" -o $DATAFILE.bin
+
+	$PSQL -c "TRUNCATE $table" || exit 1
+	run "  COPY FROM text" \
+		$PSQL -c "COPY $table FROM STDIN" < $DATAFILE.txt
+
+	$PSQL -c "TRUNCATE $table" || exit 1
+	run "  COPY FROM binary" \
+		$PSQL -c "COPY $table FROM STDIN (FORMAT binary)" < $DATAFILE.bin
+
+	# Eight columns per row, so that the per-value send and receive
+	# functions rather than the per-row COPY overhead dominate
+	$PSQL -c "CREATE UNLOGGED TABLE ${table}_wide AS
+			  SELECT v v1, v v2, v v3, v v4, v v5, v v6, v v7, v v8 FROM $table" \
+		|| exit 1
+	run "  COPY TO binary x8" \
+		$PSQL -c "COPY ${table}_wide TO STDOUT (FORMAT binary)" -o $DATAFILE.bin
+	$PSQL -c "TRUNCATE ${table}_wide" || exit 1
+	run "  COPY FROM binary x8" \
+		$PSQL -c "COPY ${table}_wide FROM STDIN (FORMAT binary)" < $DATAFILE.bin
+	$PSQL -c "DROP TABLE ${table}_wide" || exit 1
+
+	run "  sort" \
+		$PSQL -c "SET max_parallel_workers_per_gather = 0" \
+			  -c "SELECT count(*) FROM (SELECT v FROM $table ORDER BY v OFFSET 0) s" \
+			  -o /dev/null
+	run "  index build" \
+		$PSQL -c "SET max_parallel_maintenance_workers = 0" \
+			  -c "CREATE INDEX ${table}_v ON $table (v)"
+
+	$PSQL -c "DROP TABLE $table" || exit 1
+done
@@ -0,0 +1,182 @@
+/*-------------------------------------------------------------------------
+ *
+ * numutils_bench.c
+ *	  Microbenchmark for the unsigned integer string conversions
+ *
+ *	  Links uints_numutils.c directly, outside the server, and times
+ *	  pg_uXtoa and pg_atouX over arrays of random values whose digit counts
+ *	  are spread evenly over each type's range.  Every parsed value is
+ *	  checked against the original.
+ *
+ *	  Usage: numutils_bench [values per type]
+ *
+ * Portions Copyright (c) 1996-2013, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "c.h"
+
+#include <time.h>
+
+#include "uints_numutils.h"
+
+#define DEFAULT_NVALUES 10000000
+
+/*
+ * The conversions only report errors, and the benchmark feeds them valid
+ * input, so reaching any of these is a bug.
+ */
+bool
+errstart(int elevel, const char *domain)
+{
+	fprintf(stderr, "unexpected error report\n");
+	abort();
+}
+
+bool
+errstart_cold(int elevel, const char *domain)
+{
+	return errstart(elevel, domain);
+}
+
+void
+errfinish(const char *filename, int lineno, const char *funcname)
+{
+	abort();
+}
+
+int
+errcode(int sqlerrcode)
+{
+	return 0;
+}
+
+int
+errmsg(const char *fmt,...)
+{
+	return 0;
+}
+
+int
+errmsg_internal(const char *fmt,...)
+{
+	return 0;
+}
+
+static uint64 rng_state = UINT64CONST(0x9E3779B97F4A7C15);
+
+/* xorshift64*, good enough to pick test values */
+static uint64
+next_random(void)
+{
+	rng_state ^= rng_state >> 12;
+	rng_state ^= rng_state << 25;
+	rng_state ^= rng_state >> 27;
+	return rng_state * UINT64CONST(0x2545F4914F6CDD1D);
+}
+
+/* A random value of at most bits bits, with the bit length itself random */
+static uint64
+random_value(int bits)
+{
+	int			len = 1 + next_random() % bits;
+	uint64		v = next_random();
+
+	return len == 64 ? v : v & ((UINT64CONST(1) << len) - 1);
+}
+
+static double
+now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (double) ts.tv_sec * 1e9 + (double) ts.tv_nsec;
+}
+
+static void
+report(const char *name, long n, double ns)
+{
+	printf("  %-10s %14.0f values/s %8.2f ns/value\n",
+		   name, n / (ns / 1e9), ns / n);
+}
+
+/*
+ * Time formatting and parsing of n values of one width.  Strings are stored
+ * at a fixed stride so that parsing doesn't depend on the formatter's output
+ * layout.
+ */
+#define BENCH_TYPE(type, bits, maxlen, toa, atou) \
+static void \
+bench_##type(long n) \
+{ \
+	uint64	   *values = malloc(n * sizeof(uint64)); \
+	char	   *strings = malloc(n * (maxlen + 1)); \
+	uint64		check = 0; \
+	double		start; \
+	long		i; \
+	\
+	if (values == NULL || strings == NULL) \
+	{ \
+		fprintf(stderr, "out of memory\n"); \
+		exit(1); \
+	} \
+	for (i = 0; i < n; i++) \
+		values[i] = random_value(bits); \
+	\
+	printf(#type "\n"); \
+	\
+	start = now_ns(); \
+	for (i = 0; i < n; i++) \
+		toa(values[i], strings + i * (maxlen + 1)); \
+	report("format", n, now_ns() - start); \
+	\
+	start = now_ns(); \
+	for (i = 0; i < n; i++) \
+		check += atou(strings + i * (maxlen + 1), '\0'); \
+	report("parse", n, now_ns() - start); \
+	\
+	for (i = 0; i < n; i++) \
+	{ \
+		check -= values[i]; \
+		if (atou(strings + i * (maxlen + 1), '\0') != values[i]) \
+		{ \
+			fprintf(stderr, "round trip failed for %s\n", \
+					strings + i * (maxlen + 1)); \
+			exit(1); \
+		} \
+	} \
+	if (check != 0) \
+		exit(1); \
+	\
+	free(values); \
+	free(strings); \
+}
+
+BENCH_TYPE(uint1, 8, MAXUINT1LEN, pg_u1toa, pg_atou1)
+BENCH_TYPE(uint2, 16, MAXUINT2LEN, pg_u2toa, pg_atou2)
+BENCH_TYPE(uint4, 32, MAXUINT4LEN, pg_u4toa, pg_atou4)
+BENCH_TYPE(uint8, 64, MAXUINT8LEN, pg_u8toa, pg_atou8)
+
+int
+main(int argc, char **argv)
+{
+	long		n = DEFAULT_NVALUES;
+
+	if (argc > 1)
+		n = atol(argv[1]);
+	if (n <= 0)
+	{
+		fprintf(stderr, "usage: %s [values per type]\n", argv[0]);
+		return 1;
+	}
+
+	bench_uint1(n);
+	bench_uint2(n);
+	bench_uint4(n);
+	bench_uint8(n);
+
+	return 0;
+}
@@ -0,0 +1,496 @@
+CREATE EXTENSION uints;
+--
+-- Plan inspection helpers
+--
+-- estimated rows at the top of the plan
+CREATE FUNCTION plan_estimate(query text) RETURNS float8
+LANGUAGE plpgsql AS $$
+DECLARE
+    plan json;
+BEGIN
+    EXECUTE 'EXPLAIN (FORMAT JSON) ' || query INTO plan;
+    RETURN plan->0->'Plan'->>'Plan Rows';
+END
+$$;
+-- number of plan lines that mention node
+CREATE FUNCTION plan_count(query text, node text) RETURNS int
+LANGUAGE plpgsql AS $$
+DECLARE
+    line text;
+    n int := 0;
+BEGIN
+    FOR line IN EXECUTE 'EXPLAIN (COSTS OFF) ' || query LOOP
+        IF line LIKE '%' || node || '%' THEN
+            n := n + 1;
+        END IF;
+    END LOOP;
+    RETURN n;
+END
+$$;
+--
+-- Parallel query over uint columns
+--
+CREATE TABLE t_parallel (c4 uint4);
+INSERT INTO t_parallel SELECT i::uint4 FROM generate_series(1, 10000) i;
+ANALYZE t_parallel;
+SET parallel_setup_cost = 0;
+SET parallel_tuple_cost = 0;
+SET min_parallel_table_scan_size = 0;
+SET max_parallel_workers_per_gather = 2;
+EXPLAIN (COSTS OFF)
+SELECT sum(c4) FROM t_parallel WHERE c4 > '5000'::uint4;
+SELECT sum(c4), count(*) FROM t_parallel WHERE c4 > '5000'::uint4;
+RESET parallel_setup_cost;
+RESET parallel_tuple_cost;
+RESET min_parallel_table_scan_size;
+RESET max_parallel_workers_per_gather;
+DROP TABLE t_parallel;
+--
+-- Cross-type comparisons with signed integers
+--
+SELECT '0'::uint4 > -1 AS a, '4294967295'::uint4 = -1 AS b,
+       -1::int8 < '0'::uint8 AS c, '65535'::uint2 >= 65535 AS d;
+SELECT -1 < '0'::uint4 AS a, 5::int2 = '5'::uint2 AS b,
+       4294967295::int8 >= '4294967295'::uint4 AS c, 0 <> '0'::uint8 AS d;
+CREATE TABLE t_cross (c4 uint4, t text);
+INSERT INTO t_cross SELECT i::uint4, i::text FROM generate_series(1, 1000) i;
+CREATE INDEX t_cross_c4 ON t_cross (c4);
+ANALYZE t_cross;
+SET enable_seqscan = off;
+SET enable_bitmapscan = off;
+EXPLAIN (COSTS OFF)
+SELECT * FROM t_cross WHERE c4 = 5;
+SELECT * FROM t_cross WHERE c4 < 3::int8 ORDER BY c4;
+RESET enable_seqscan;
+RESET enable_bitmapscan;
+DROP TABLE t_cross;
+--
+-- Selectivity estimates and join methods
+--
+-- values 3000000001 .. 3000010000, all above 2^31
+CREATE TABLE t_sel (c2 uint2, c4 uint4);
+INSERT INTO t_sel
+SELECT (i % 1000)::uint2, (3000000000 + i)::uint8::uint4
+FROM generate_series(1, 10000) i;
+ANALYZE t_sel;
+-- 2524 rows are below the constant and 7475 above it; the estimates
+-- interpolate within the histogram bin instead of taking its midpoint
+SELECT abs(plan_estimate('SELECT * FROM t_sel WHERE c4 < ''3000002525''') - 2524) < 10 AS lt,
+       abs(plan_estimate('SELECT * FROM t_sel WHERE c4 > ''3000002525''') - 7475) < 10 AS gt,
+       abs(plan_estimate('SELECT * FROM t_sel WHERE ''3000002525'' > c4') - 2524) < 10 AS commuted;
+SELECT abs(plan_estimate('SELECT * FROM t_sel WHERE c4 < ''3000002525''::uint8') - 2524) < 10 AS lt8,
+       abs(plan_estimate('SELECT * FROM t_sel WHERE c4 >= ''3000002525''::uint8') - 7475) < 10 AS ge8;
+-- "<=" and ">=" also count the rows equal to the constant, one here
+SELECT plan_estimate('SELECT * FROM t_sel WHERE c4 <= ''3000002525''') -
+       plan_estimate('SELECT * FROM t_sel WHERE c4 < ''3000002525''') AS le_minus_lt,
+       plan_estimate('SELECT * FROM t_sel WHERE c4 >= ''3000002525''') -
+       plan_estimate('SELECT * FROM t_sel WHERE c4 > ''3000002525''') AS ge_minus_gt,
+       plan_estimate('SELECT * FROM t_sel WHERE c4 > ''4294967295''') AS gt_max;
+SET enable_nestloop = off;
+SET enable_mergejoin = off;
+SELECT plan_count('SELECT * FROM t_sel a JOIN t_sel b ON a.c2 = b.c2', 'Hash Join') > 0 AS hash2,
+       plan_count('SELECT * FROM t_sel a JOIN t_sel b ON a.c4 = b.c4', 'Hash Join') > 0 AS hash4;
+-- signed on the left: hashing needs (int4, uint2) in a hash family
+CREATE TABLE t_signed (i int4);
+INSERT INTO t_signed VALUES (-1), (0), (1), (999), (1000);
+SELECT plan_count('SELECT * FROM t_signed a JOIN t_sel b ON a.i = b.c2', 'Hash Join') > 0 AS hash_signed;
+SELECT count(*) FROM t_signed a JOIN t_sel b ON a.i = b.c2;
+SET enable_hashjoin = off;
+SET enable_mergejoin = on;
+SELECT plan_count('SELECT * FROM t_sel a JOIN t_sel b ON a.c2 = b.c2', 'Merge Join') > 0 AS merge2,
+       plan_count('SELECT * FROM t_sel a JOIN t_sel b ON a.c4 = b.c4', 'Merge Join') > 0 AS merge4;
+RESET enable_nestloop;
+RESET enable_mergejoin;
+RESET enable_hashjoin;
+SELECT count(*) FROM t_sel a JOIN t_sel b ON a.c4 = b.c4;
+DROP TABLE t_sel, t_signed;
+--
+-- Text output at digit-count and word-size boundaries
+--
+SELECT v::uint8 AS v, v::uint8::uint4 AS v4
+FROM (VALUES ('0'), ('9'), ('10'), ('99999999'), ('100000000'),
+             ('4294967295')) AS t(v);
+SELECT v::uint8 AS v
+FROM (VALUES ('4294967296'), ('10000000000000000000'),
+             ('18446744073709551615')) AS t(v);
+--
+-- Text input
+--
+SELECT '-1'::uint4;
+SELECT '4294967296'::uint4;
+SELECT '18446744073709551616'::uint8;
+SELECT ' 12x'::uint2;
+SELECT ''::uint1;
+SELECT ' +42 '::uint4, '-0'::uint8,
+       '000000000000000000000000018446744073709551615'::uint8;
+--
+-- uint1 casts
+--
+SELECT '255'::uint1::int4 + 1 AS a, pg_typeof('7'::uint1::int4) AS b;
+CREATE TABLE t_u1 (c uint1, i int4);
+INSERT INTO t_u1 VALUES ('200', 0);
+UPDATE t_u1 SET i = c;
+SELECT i, c = 200 AS eq FROM t_u1;
+DROP TABLE t_u1;
+--
+-- BRIN
+--
+CREATE TABLE t_brin (c2 uint2, c4 uint4, c8 uint8);
+INSERT INTO t_brin SELECT i::uint2, i::uint4, i::int8::uint8
+    FROM generate_series(1, 10000) i;
+CREATE INDEX t_brin_c2 ON t_brin USING brin (c2 uint2_minmax_multi_ops);
+CREATE INDEX t_brin_c4 ON t_brin USING brin (c4);
+CREATE INDEX t_brin_c8 ON t_brin USING brin (c8 uint8_bloom_ops);
+SET enable_seqscan = off;
+EXPLAIN (COSTS OFF)
+SELECT count(*) FROM t_brin WHERE c4 > 9000;
+SELECT count(*) FROM t_brin WHERE c4 > 9000;
+EXPLAIN (COSTS OFF)
+SELECT count(*) FROM t_brin WHERE c8 = '12345'::uint8;
+SELECT count(*) FROM t_brin WHERE c8 = '1234'::uint8;
+SELECT count(*) FROM t_brin WHERE c2 BETWEEN '100' AND '199';
+RESET enable_seqscan;
+DROP TABLE t_brin;
+--
+-- GiST: exclusion constraints and nearest-neighbour search
+--
+CREATE TABLE t_gist (tenant uint4, during int4range,
+    EXCLUDE USING gist (tenant WITH =, during WITH &&));
+INSERT INTO t_gist VALUES ('1', '[1,10)'), ('2', '[1,10)');
+INSERT INTO t_gist VALUES ('1', '[5,15)');
+DROP TABLE t_gist;
+CREATE TABLE t_knn (c4 uint4, t text);
+INSERT INTO t_knn SELECT (i * 7)::uint4, i::text FROM generate_series(1, 10000) i;
+CREATE INDEX t_knn_c4 ON t_knn USING gist (c4);
+ANALYZE t_knn;
+SET enable_seqscan = off;
+EXPLAIN (COSTS OFF)
+SELECT * FROM t_knn ORDER BY c4 <-> 12345 LIMIT 3;
+SELECT * FROM t_knn ORDER BY c4 <-> 12345 LIMIT 3;
+SELECT * FROM t_knn WHERE c4 = 70000 OR c4 < -1;
+RESET enable_seqscan;
+DROP TABLE t_knn;
+--
+-- Range types
+--
+SELECT '(1,5]'::uint4range AS a, '[0,4294967295)'::uint4range AS b,
+       '(18446744073709551613,18446744073709551614]'::uint8range AS c;
+CREATE TABLE t_range (id int4, r uint4range);
+INSERT INTO t_range
+    SELECT i, uint4range((i * 10)::uint4, (i * 10 + 5)::uint4)
+    FROM generate_series(1, 1000) i;
+CREATE INDEX t_range_r ON t_range USING gist (r);
+ANALYZE t_range;
+SET enable_seqscan = off;
+SET enable_bitmapscan = off;
+EXPLAIN (COSTS OFF)
+SELECT id FROM t_range WHERE r && '[100,120)'::uint4range;
+SELECT id FROM t_range WHERE r && '[100,120)'::uint4range ORDER BY id;
+DROP INDEX t_range_r;
+CREATE INDEX t_range_r ON t_range USING spgist (r);
+EXPLAIN (COSTS OFF)
+SELECT id FROM t_range WHERE r @> '112'::uint4;
+SELECT id FROM t_range WHERE r @> '112'::uint4;
+RESET enable_seqscan;
+RESET enable_bitmapscan;
+DROP TABLE t_range;
+--
+-- Arrays
+--
+SELECT icount('{3,1,2,3}'::uint4[]) AS n, # '{3,1}'::uint8[] AS m,
+       sort('{3,1,2,3}'::uint4[]) AS s, sort('{3,1,2}'::uint8[], 'desc') AS d,
+       uniq(sort('{3,1,2,3}'::uint4[])) AS u, '{5,6,7}'::uint4[] # '7'::uint4 AS i;
+SELECT '{4,1,3,1}'::uint4[] & '{3,4,5}'::uint4[] AS inter,
+       '{4,1,3,1}'::uint4[] | '{3,4,5}'::uint4[] AS "union",
+       '{18446744073709551615,1}'::uint8[] & '{18446744073709551615}'::uint8[] AS big;
+SELECT sort('{1,NULL}'::uint4[]);
+CREATE TABLE t_gin (id int4, tags uint4[]);
+INSERT INTO t_gin
+    SELECT i, ARRAY[(i % 10)::uint4, (i % 7 + 100)::uint4]
+    FROM generate_series(1, 1000) i;
+CREATE INDEX t_gin_tags ON t_gin USING gin (tags);
+SET enable_seqscan = off;
+EXPLAIN (COSTS OFF)
+SELECT count(*) FROM t_gin WHERE tags @> '{3,103}';
+SELECT count(*) FROM t_gin WHERE tags @> '{3,103}';
+SELECT count(*) FROM t_gin WHERE tags && '{200,5}';
+RESET enable_seqscan;
+DROP TABLE t_gin;
+--
+-- Compressed sets
+--
+SELECT '{5, 3,3, 4294967295,0}'::uint4set AS s, '{}'::uint4set AS e,
+       # '{1,2,2}'::uint4set AS n;
+SELECT '{1,x}'::uint4set;
+SELECT '1,2'::uint4set;
+CREATE TABLE t_set AS
+    SELECT uint4set(array_agg((i * 3)::uint4)) AS a,
+           uint4set(array_agg((i * 5)::uint4)) AS b
+    FROM generate_series(1, 100000) i;
+SELECT # a AS na, # b AS nb, # (a & b) AS ni, # (a | b) AS nu,
+       pg_column_size(a) * 10 < pg_column_size(a::uint4[]) AS smaller
+FROM t_set;
+SELECT a @> '300000'::uint4 AS x, a @> '300001'::uint4 AS y,
+       '15'::uint4 <@ (a & b) AS z
+FROM t_set;
+SELECT (a & b)::uint4[] = ARRAY(SELECT (i * 15)::uint4
+                                FROM generate_series(1, 20000) i) AS inter,
+       (a | b)::uint4[] = ARRAY(SELECT DISTINCT v FROM t_set,
+                                LATERAL unnest(a::uint4[] || b::uint4[]) v
+                                ORDER BY v) AS "union"
+FROM t_set;
+DROP TABLE t_set;
+--
+-- Roaring bitmaps
+--
+SELECT '{7,3,3,65536,4294967295}'::uint4bitmap AS b, # '{}'::uint4bitmap AS n;
+SELECT '{1,2,3}'::uint4bitmap & '{2,3,4}' AS "and",
+       '{1,2,3}'::uint4bitmap | '{2,3,4}' AS "or",
+       '{1,2,3}'::uint4bitmap # '{2,3,4}' AS "xor",
+       '{1,2,3}'::uint4bitmap - '{2,3,4}' AS andnot;
+SELECT '{1'::uint4bitmap;
+SELECT '{1,x,3}'::uint4bitmap;
+CREATE TABLE t_bitmap (day int4, uid uint4);
+INSERT INTO t_bitmap
+    SELECT i % 7, ((i::int8 * 7919) % 200000)::int4::uint4 FROM generate_series(1, 300000) i;
+CREATE TABLE t_daily AS
+    SELECT day, uint4bitmap_agg(uid) AS users FROM t_bitmap GROUP BY day;
+SELECT day, # users AS n FROM t_daily ORDER BY day;
+SELECT bool_and(# users = (SELECT count(DISTINCT uid) FROM t_bitmap b
+                           WHERE b.day = d.day)) AS ok
+FROM t_daily d;
+SELECT # uint4bitmap_or_agg(users) AS total FROM t_daily;
+SELECT # (a.users & b.users) AS "and", # (a.users | b.users) AS "or",
+       # (a.users # b.users) AS "xor", # (a.users - b.users) AS andnot
+FROM t_daily a, t_daily b WHERE a.day = 0 AND b.day = 3;
+SELECT users @> '7919'::uint4 AS x, '7919'::uint4 <@ users AS y,
+       users @> '199999'::uint4 AS z
+FROM t_daily WHERE day = 1;
+SELECT count(*) AS n, min(v) AS lo, max(v) AS hi
+FROM t_daily, uint4bitmap_values(users) v WHERE day = 2;
+SET parallel_setup_cost = 0;
+SET parallel_tuple_cost = 0;
+SET min_parallel_table_scan_size = 0;
+SET max_parallel_workers_per_gather = 2;
+EXPLAIN (COSTS OFF)
+SELECT # uint4bitmap_agg(uid) AS n FROM t_bitmap;
+SELECT # uint4bitmap_agg(uid) AS n FROM t_bitmap;
+SELECT uint4bitmap_agg(NULL::uint4) IS NULL AS is_null FROM t_bitmap;
+RESET parallel_setup_cost;
+RESET parallel_tuple_cost;
+RESET min_parallel_table_scan_size;
+RESET max_parallel_workers_per_gather;
+SELECT uint4bitmap_agg(NULL::uint4) IS NULL AS is_null FROM generate_series(1, 3);
+SELECT uint4bitmap_or_agg(NULL::uint4bitmap) IS NULL AS is_null
+FROM generate_series(1, 3);
+SELECT # uint4bitmap_agg(v) AS n FROM (VALUES (NULL::uint4), ('7'), (NULL), ('9')) t(v);
+DROP TABLE t_bitmap, t_daily;
+--
+-- Series
+--
+SELECT * FROM generate_series('4294967290'::uint4, '4294967295'::uint4, 2);
+SELECT * FROM generate_series('5'::uint4, '0'::uint4, -2);
+SELECT * FROM generate_series('18446744073709551613'::uint8,
+                              '18446744073709551615'::uint8);
+SELECT * FROM generate_series('3'::uint8, '0'::uint8, -9223372036854775808);
+SELECT * FROM generate_series('1'::uint4, '0'::uint4);
+SELECT generate_series('1'::uint4, '3'::uint4) AS g, 'x' AS t;
+SELECT * FROM generate_series('1'::uint4, '2'::uint4, 0);
+SELECT plan_estimate('SELECT * FROM generate_series(''1''::uint4, ''1000000''::uint4, 3)') AS a,
+       plan_estimate('SELECT * FROM generate_series(''18446744073709551615''::uint8, ''0''::uint8, -1000000000000)') AS b,
+       plan_estimate('SELECT * FROM generate_series(''5''::uint4, ''0''::uint4)') AS c;
+SET uints.series_end = '250';
+SELECT plan_estimate('SELECT * FROM generate_series(''1''::uint4, current_setting(''uints.series_end'')::uint4)') AS stable;
+PREPARE series_step(int8) AS
+    SELECT * FROM generate_series('1'::uint8, '100'::uint8, $1);
+SET plan_cache_mode = force_generic_plan;
+SELECT plan_estimate('EXECUTE series_step(5)') AS generic;
+SET plan_cache_mode = force_custom_plan;
+SELECT plan_estimate('EXECUTE series_step(5)') AS custom;
+RESET plan_cache_mode;
+DEALLOCATE series_step;
+RESET uints.series_end;
+--
+-- Extended hashing
+--
+SELECT uint1_hash_extended('200', 7) = hashint2extended(200::int2, 7) AS u1,
+       uint2_hash_extended('65535', 7) = hashint4extended(65535, 7) AS u2,
+       uint4_hash_extended('4294967295', 7) = hashint8extended(4294967295, 7) AS u4,
+       uint8_hash_extended('4294967296', 7) = hashint8extended(4294967296, 7) AS u8,
+       uint8_hash_extended('42', 7) = uint4_hash_extended('42', 7) AS u8u4,
+       uint4_hash_extended('42', 0) & 4294967295 = uint4_hash('42') & 4294967295 AS seed0;
+CREATE TABLE t_hashpart (id uint4) PARTITION BY HASH (id);
+CREATE TABLE t_hashpart_0 PARTITION OF t_hashpart FOR VALUES WITH (MODULUS 2, REMAINDER 0);
+CREATE TABLE t_hashpart_1 PARTITION OF t_hashpart FOR VALUES WITH (MODULUS 2, REMAINDER 1);
+CREATE TABLE t_hashint (id int4) PARTITION BY HASH (id);
+CREATE TABLE t_hashint_0 PARTITION OF t_hashint FOR VALUES WITH (MODULUS 2, REMAINDER 0);
+CREATE TABLE t_hashint_1 PARTITION OF t_hashint FOR VALUES WITH (MODULUS 2, REMAINDER 1);
+INSERT INTO t_hashpart SELECT i::uint4 FROM generate_series(1, 1000) i;
+INSERT INTO t_hashint SELECT i FROM generate_series(1, 1000) i;
+-- equal values land in partitions with the same remainder
+SELECT (SELECT count(*) FROM t_hashpart_0 u JOIN t_hashint_0 i ON u.id = i.id) +
+       (SELECT count(*) FROM t_hashpart_1 u JOIN t_hashint_1 i ON u.id = i.id) AS same;
+SELECT count(*) FROM t_hashpart WHERE id = '500';
+DROP TABLE t_hashpart, t_hashint;
+CREATE TABLE t_hashpart8 (id uint8) PARTITION BY HASH (id);
+CREATE TABLE t_hashpart8_0 PARTITION OF t_hashpart8 FOR VALUES WITH (MODULUS 2, REMAINDER 0);
+CREATE TABLE t_hashpart8_1 PARTITION OF t_hashpart8 FOR VALUES WITH (MODULUS 2, REMAINDER 1);
+INSERT INTO t_hashpart8 VALUES ('1'), ('18446744073709551615');
+SELECT count(*) FROM t_hashpart8 WHERE id = '18446744073709551615';
+DROP TABLE t_hashpart8;
+--
+-- Partition pruning
+--
+CREATE TABLE t_shard (key uint8, v int) PARTITION BY HASH (key);
+DO $$
+BEGIN
+    FOR r IN 0..255 LOOP
+        EXECUTE format('CREATE TABLE t_shard_%s PARTITION OF t_shard '
+                       'FOR VALUES WITH (MODULUS 256, REMAINDER %s)', r, r);
+    END LOOP;
+END
+$$;
+INSERT INTO t_shard SELECT i::int8::uint8, i FROM generate_series(1, 10000) i;
+SELECT plan_count('SELECT * FROM t_shard', 'Scan on') AS all_parts,
+       plan_count('SELECT * FROM t_shard WHERE key = ''4242''::uint8', 'Scan on') AS u8,
+       plan_count('SELECT * FROM t_shard WHERE key = 4242::int8', 'Scan on') AS i8,
+       plan_count('SELECT * FROM t_shard WHERE key = 4242', 'Scan on') AS i4;
+SELECT v FROM t_shard WHERE key = 4242::int8;
+PREPARE shard_q(int8) AS SELECT v FROM t_shard WHERE key = $1;
+SET plan_cache_mode = force_generic_plan;
+SELECT plan_count('EXECUTE shard_q(4242)', 'Scan on') AS generic;
+EXECUTE shard_q(4242);
+EXECUTE shard_q(-1);
+RESET plan_cache_mode;
+DEALLOCATE shard_q;
+DROP TABLE t_shard;
+CREATE TABLE t_range (key uint4) PARTITION BY RANGE (key);
+CREATE TABLE t_range_low PARTITION OF t_range FOR VALUES FROM ('0') TO ('2147483648');
+CREATE TABLE t_range_high PARTITION OF t_range FOR VALUES FROM ('2147483648') TO (MAXVALUE);
+INSERT INTO t_range VALUES ('1'), ('2147483647'), ('2147483648'), ('4294967295');
+EXPLAIN (COSTS OFF) SELECT * FROM t_range WHERE key > 3000000000::int8;
+EXPLAIN (COSTS OFF) SELECT * FROM t_range WHERE key < 5;
+EXPLAIN (COSTS OFF) SELECT * FROM t_range WHERE key = -1;
+SELECT * FROM t_range WHERE key >= 2147483648::int8 ORDER BY key;
+PREPARE range_q(int8) AS SELECT * FROM t_range WHERE key >= $1;
+SET plan_cache_mode = force_generic_plan;
+SELECT plan_count('EXECUTE range_q(3000000000)', 'Scan on') AS high,
+       plan_count('EXECUTE range_q(-5)', 'Scan on') AS both_parts;
+EXECUTE range_q(3000000000);
+RESET plan_cache_mode;
+DEALLOCATE range_q;
+DROP TABLE t_range;
+--
+-- Window RANGE frames
+--
+CREATE TABLE t_window (seq uint4 PRIMARY KEY, x int);
+INSERT INTO t_window SELECT (i * 500)::uint4, i FROM generate_series(1, 6) i;
+SELECT seq, sum(x) OVER (ORDER BY seq RANGE BETWEEN 1000 PRECEDING AND CURRENT ROW)
+FROM t_window ORDER BY seq;
+SELECT seq, count(*) OVER (ORDER BY seq DESC RANGE BETWEEN CURRENT ROW AND '600'::uint2 FOLLOWING)
+FROM t_window ORDER BY seq;
+SELECT seq, sum(x) OVER (ORDER BY seq RANGE BETWEEN -1 PRECEDING AND CURRENT ROW)
+FROM t_window;
+DROP TABLE t_window;
+SELECT v, count(*) OVER (ORDER BY v RANGE BETWEEN '10'::uint8 PRECEDING AND '10'::uint8 FOLLOWING)
+FROM (VALUES ('0'::uint8), ('5'), ('18446744073709551610'), ('18446744073709551615')) t(v);
+SELECT v, count(*) OVER (ORDER BY v RANGE BETWEEN CURRENT ROW AND '100000'::uint4 FOLLOWING)
+FROM (VALUES ('0'::uint2), ('65535')) t(v);
+--
+-- Min/max and index-only scans
+--
+CREATE TABLE t_events (tenant uint2, seq uint4, payload int);
+INSERT INTO t_events SELECT (i % 5)::uint2, i::uint4, i FROM generate_series(1, 10000) i;
+INSERT INTO t_events VALUES ('65535', '4294967295', 0);
+CREATE INDEX t_events_seq ON t_events (seq);
+CREATE INDEX t_events_tenant_seq ON t_events (tenant, seq);
+VACUUM ANALYZE t_events;
+SELECT plan_count('SELECT max(seq) FROM t_events', 'Index Only Scan Backward using t_events_seq') > 0 AS max_seq,
+       plan_count('SELECT min(seq) FROM t_events', 'Index Only Scan using t_events_seq') > 0 AS min_seq,
+       plan_count('SELECT max(seq) FROM t_events WHERE tenant = ''3''', 'Index Only Scan Backward using t_events_tenant_seq') > 0 AS max_tenant,
+       plan_count('SELECT seq FROM t_events WHERE seq BETWEEN ''100'' AND ''110''', 'Index Only Scan using t_events_seq') > 0 AS range_seq;
+SELECT max(seq), min(seq), max(tenant), min(tenant) FROM t_events;
+SELECT max(seq) FROM t_events WHERE tenant = '3';
+SELECT count(*) FROM t_events WHERE seq BETWEEN '100' AND '110';
+SELECT tenant, seq FROM t_events WHERE seq IN ('3', '4294967295') ORDER BY seq;
+SELECT count(*) FROM t_events WHERE tenant > '3' AND seq < '20';
+DROP TABLE t_events;
+--
+-- Binary send
+--
+SELECT uint1send('200') AS u1, uint2send('65534') AS u2,
+       uint4send('4294967294') AS u4, uint8send('18446744073709551614') AS u8;
+SELECT uint4send('1') AS u4, uint8send('1') AS u8;
+--
+-- Variable-length uintv
+--
+CREATE TABLE t_uintv (v uintv);
+INSERT INTO t_uintv VALUES ('0'), ('200'), ('65536'), ('4294967295'), ('18446744073709551615');
+INSERT INTO t_uintv SELECT '256'::uint4;
+INSERT INTO t_uintv SELECT '4294967296'::uint8;
+SELECT v, pg_column_size(v) AS size FROM t_uintv ORDER BY v;
+SELECT max(v), min(v), pg_typeof(max(v)) AS type, count(DISTINCT v) FROM t_uintv;
+SELECT '255'::uintv < '256' AS a, '65535'::uintv > '256' AS b,
+       '18446744073709551615'::uintv = '18446744073709551615' AS c,
+       '0'::uintv < '1' AS d, '00042'::uintv = '42' AS e;
+SELECT '42'::uintv = 42 AS a, 42::int8 = '42'::uintv AS b, '5'::uintv > -1 AS c,
+       (-1)::int2 < '0'::uintv AS d,
+       '18446744073709551615'::uintv > 9223372036854775807 AS e,
+       '4294967296'::uintv = '4294967296'::uint8 AS f,
+       '65535'::uint2 = '65535'::uintv AS g,
+       '4294967295'::uintv <> '4294967295'::uint4 AS h;
+SELECT v::uint4 FROM t_uintv WHERE v < '65537' ORDER BY 1;
+SELECT '4294967296'::uintv::uint4;
+SELECT '-1'::uintv;
+SELECT '18446744073709551616'::uintv;
+SELECT uintv_hash('4242') = uint8_hash('4242') AS h,
+       uintv_hash_extended('4242', 3) = uint8_hash_extended('4242', 3) AS hx,
+       uintvsend('258') AS send;
+CREATE INDEX t_uintv_v ON t_uintv (v);
+SET enable_seqscan = off;
+SELECT v FROM t_uintv WHERE v >= '65536' ORDER BY v;
+SET enable_bitmapscan = off;
+EXPLAIN (COSTS OFF) SELECT v FROM t_uintv WHERE v = 42;
+SELECT v FROM t_uintv WHERE v = 200 OR v > 4294967295::int8 ORDER BY v;
+RESET enable_seqscan;
+RESET enable_bitmapscan;
+SELECT a.v FROM t_uintv a JOIN t_uintv b ON a.v = b.v WHERE a.v < '1000' ORDER BY 1;
+SELECT count(*) FROM t_uintv a JOIN (SELECT v::uint8 AS w FROM t_uintv) b ON a.v = b.w;
+DROP TABLE t_uintv;
+-- the estimators decode uintv histogram bounds
+CREATE TABLE t_uintv_sel (v uintv);
+INSERT INTO t_uintv_sel SELECT (5000000000 + i)::uint8 FROM generate_series(1, 10000) i;
+ANALYZE t_uintv_sel;
+SELECT abs(plan_estimate('SELECT * FROM t_uintv_sel WHERE v < ''5000002525''') - 2524) < 10 AS lt,
+       abs(plan_estimate('SELECT * FROM t_uintv_sel WHERE v >= ''5000002525''') - 7476) < 10 AS ge;
+DROP TABLE t_uintv_sel;
+--
+-- Binary round trip
+--
+CREATE TABLE t_bin (c1 uint1, c2 uint2, c4 uint4, c8 uint8, cv uintv);
+INSERT INTO t_bin VALUES
+    ('0', '0', '0', '0', '0'),
+    ('1', '258', '65536', '4294967296', '256'),
+    ('127', '32768', '2147483648', '9223372036854775808', '4294967295'),
+    ('255', '65535', '4294967295', '18446744073709551615', '18446744073709551615');
+\copy t_bin TO 'results/uints_binary.dat' (FORMAT binary)
+CREATE TABLE t_bin2 (LIKE t_bin);
+\copy t_bin2 FROM 'results/uints_binary.dat' (FORMAT binary)
+SELECT * FROM t_bin2 ORDER BY c4;
+SELECT count(*) AS differing
+FROM ((TABLE t_bin EXCEPT TABLE t_bin2) UNION ALL (TABLE t_bin2 EXCEPT TABLE t_bin)) d;
+-- fields shorter than the type: a uint2 read as uint4 and so on
+CREATE TABLE t_short (c uint4);
+\copy (SELECT c2 FROM t_bin) TO 'results/uints_binary.dat' (FORMAT binary)
+\copy t_short FROM 'results/uints_binary.dat' (FORMAT binary)
+ALTER TABLE t_short ALTER c TYPE uint8;
+\copy (SELECT c4 FROM t_bin) TO 'results/uints_binary.dat' (FORMAT binary)
+\copy t_short FROM 'results/uints_binary.dat' (FORMAT binary)
+ALTER TABLE t_short ALTER c TYPE uintv;
+\copy t_short FROM 'results/uints_binary.dat' (FORMAT binary)
+DROP TABLE t_short;
+CREATE TABLE t_short (c uint1);
+\copy (SELECT ''::bytea) TO 'results/uints_binary.dat' (FORMAT binary)
+\copy t_short FROM 'results/uints_binary.dat' (FORMAT binary)
+DROP TABLE t_bin, t_bin2, t_short;
+DROP FUNCTION plan_estimate(text), plan_count(text, text);
@@ -0,0 +1,32 @@
+--
+-- Btree deduplication
+--
+SET client_min_messages = warning;
+CREATE EXTENSION IF NOT EXISTS uints;
+RESET client_min_messages;
+CREATE EXTENSION pageinspect;
+CREATE TABLE t_dedup (c1 uint1, c2 uint2, c4 uint4, c8 uint8);
+INSERT INTO t_dedup
+SELECT (i % 3)::uint1, (i % 3)::uint2, (i % 10)::uint4, (i % 10)::int8::uint8
+FROM generate_series(1, 10000) i;
+CREATE INDEX t_dedup_c1 ON t_dedup (c1);
+CREATE INDEX t_dedup_c2 ON t_dedup (c2);
+CREATE INDEX t_dedup_c4 ON t_dedup (c4);
+CREATE INDEX t_dedup_c8 ON t_dedup (c8);
+CREATE INDEX t_dedup_c4_off ON t_dedup (c4) WITH (deduplicate_items = off);
+SELECT (bt_metap('t_dedup_c1')).allequalimage AS c1,
+       (bt_metap('t_dedup_c2')).allequalimage AS c2,
+       (bt_metap('t_dedup_c4')).allequalimage AS c4,
+       (bt_metap('t_dedup_c8')).allequalimage AS c8;
+SELECT count(i.htids) > 0 AS posting_lists
+FROM generate_series(1, pg_relation_size('t_dedup_c2') / current_setting('block_size')::int - 1) blk,
+     bt_page_stats('t_dedup_c2', blk) s, bt_page_items('t_dedup_c2', blk) i
+WHERE s.btpo_level = 0;
+SELECT count(i.htids) > 0 AS posting_lists
+FROM generate_series(1, pg_relation_size('t_dedup_c4') / current_setting('block_size')::int - 1) blk,
+     bt_page_stats('t_dedup_c4', blk) s, bt_page_items('t_dedup_c4', blk) i
+WHERE s.btpo_level = 0;
+SELECT pg_relation_size('t_dedup_c4') * 2 < pg_relation_size('t_dedup_c4_off') AS smaller;
+SELECT count(*) FROM t_dedup WHERE c4 = '7';
+DROP TABLE t_dedup;
+DROP EXTENSION pageinspect;
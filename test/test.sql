@@ -1,12 +1,16 @@
 CREATE EXTENSION uints;
 
 CREATE TABLE t1 (
+    c1 UINT1 NOT NULL,
     c2 UINT2 NOT NULL,
-    c4 UINT4 NOT NULL
+    c4 UINT4 NOT NULL,
+    c8 UINT8 NOT NULL
 );
 
-INSERT INTO t1 VALUES (0, 0), (1, 1);
+INSERT INTO t1 VALUES ('0', '0', '0', '0'), ('1', '1', '1', '1'),
+    ('255', '65535', '4294967295', '18446744073709551615');
 SELECT * from t1;
+SELECT sum(c1), sum(c2), sum(c4), sum(c8), avg(c8), min(c4), max(c8), bit_or(c2)
+    FROM t1;
 
 DROP EXTENSION uints;
-
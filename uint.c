@@ -29,26 +29,19 @@
 #include <limits.h>
 
 #include "catalog/pg_type.h"
-#include "funcapi.h"
-#include "libpq/pqformat.h"
 #include "utils/array.h"
 #include "utils/builtins.h"
+#include "utils/sortsupport.h"
 #include "access/hash.h"
 
 #include "uints_numutils.h"
 #include "uints_fmgr.h"
+#include "uints_pqformat.h"
 
 #include "declare.h"
 
 #define SAMESIGN(a,b)	(((a) < 0) == ((b) < 0))
 
-typedef struct
-{
-	uint32		current;
-	uint32		finish;
-	uint32		step;
-} generate_series_fctx;
-
 
 
 /*****************************************************************************
@@ -75,7 +68,7 @@ Datum
 uint2out(PG_FUNCTION_ARGS)
 {
 	uint16		arg1 = PG_GETARG_UINT16(0);
-	char	   *result = (char *) palloc(6);	/* 5 digits, '\0' */
+	char	   *result = (char *) palloc(MAXUINT2LEN + 1);
 
 	pg_u2toa(arg1, result);
 	PG_RETURN_CSTRING(result);
@@ -90,7 +83,7 @@ uint2recv(PG_FUNCTION_ARGS)
 {
 	StringInfo	buf = (StringInfo) PG_GETARG_POINTER(0);
 
-	PG_RETURN_UINT16((uint16) pq_getmsgint(buf, sizeof(uint16)));
+	PG_RETURN_UINT16(uint_getmsg16(buf));
 }
 
 /*
@@ -100,12 +93,9 @@ DECLARE(uint2send)
 Datum
 uint2send(PG_FUNCTION_ARGS)
 {
-	uint16		arg1 = PG_GETARG_UINT16(0);
-	StringInfoData buf;
+	uint16		n = pg_hton16(PG_GETARG_UINT16(0));
 
-	pq_begintypsend(&buf);
-	pq_sendint(&buf, (int)arg1, sizeof(uint16));
-	PG_RETURN_BYTEA_P(pq_endtypsend(&buf));
+	PG_RETURN_BYTEA_P(uint_sendbytes(&n, sizeof(n)));
 }
 
 /*
@@ -128,7 +118,7 @@ Datum
 uint4out(PG_FUNCTION_ARGS)
 {
 	uint32		arg1 = PG_GETARG_UINT32(0);
-	char	   *result = (char *) palloc(11);	/* 10 digits, '\0' */
+	char	   *result = (char *) palloc(MAXUINT4LEN + 1);
 
 	pg_u4toa(arg1, result);
 	PG_RETURN_CSTRING(result);
@@ -143,7 +133,7 @@ uint4recv(PG_FUNCTION_ARGS)
 {
 	StringInfo	buf = (StringInfo) PG_GETARG_POINTER(0);
 
-	PG_RETURN_UINT32((uint32) pq_getmsgint(buf, sizeof(uint32)));
+	PG_RETURN_UINT32(uint_getmsg32(buf));
 }
 
 /*
@@ -153,12 +143,9 @@ DECLARE(uint4send)
 Datum
 uint4send(PG_FUNCTION_ARGS)
 {
-	uint32		arg1 = PG_GETARG_UINT32(0);
-	StringInfoData buf;
+	uint32		n = pg_hton32(PG_GETARG_UINT32(0));
 
-	pq_begintypsend(&buf);
-	pq_sendint(&buf, (int)arg1, sizeof(uint32));
-	PG_RETURN_BYTEA_P(pq_endtypsend(&buf));
+	PG_RETURN_BYTEA_P(uint_sendbytes(&n, sizeof(n)));
 }
 
 
@@ -969,99 +956,46 @@ uint2shr(PG_FUNCTION_ARGS)
 	PG_RETURN_UINT16(arg1 >> arg2);
 }
 
-/*
- * non-persistent numeric series generator
- */
-DECLARE(generate_series_uint4)
-DECLARE(generate_series_step_uint4)
+/* Comparators */
 
+DECLARE(uint2_cmp)
 Datum
-generate_series_uint4(PG_FUNCTION_ARGS)
+uint2_cmp(PG_FUNCTION_ARGS)
 {
-	return generate_series_step_uint4(fcinfo);
+	uint16		arg1 = PG_GETARG_UINT16(0);
+	uint16		arg2 = PG_GETARG_UINT16(1);
+
+	if (arg1 > arg2)
+		PG_RETURN_INT32(1);
+	else if (arg1 < arg2)
+		PG_RETURN_INT32(-1);
+	else
+		PG_RETURN_INT32(0);
 }
 
+DECLARE(uint4_cmp)
 Datum
-generate_series_step_uint4(PG_FUNCTION_ARGS)
+uint4_cmp(PG_FUNCTION_ARGS)
 {
-	FuncCallContext *funcctx;
-	generate_series_fctx *fctx;
-	uint32		result;
-	MemoryContext oldcontext;
-
-	/* stuff done only on the first call of the function */
-	if (SRF_IS_FIRSTCALL())
-	{
-		uint32		start = PG_GETARG_UINT32(0);
-		uint32		finish = PG_GETARG_UINT32(1);
-		int32		step = 1;
-
-		/* see if we were given an explicit step size */
-		if (PG_NARGS() == 3)
-			step = PG_GETARG_INT32(2);
-		if (step == 0)
-			ereport(ERROR,
-					(errcode(ERRCODE_INVALID_PARAMETER_VALUE),
-					 errmsg("step size cannot equal zero")));
-
-		/* create a function context for cross-call persistence */
-		funcctx = SRF_FIRSTCALL_INIT();
-
-		/*
-		 * switch to memory context appropriate for multiple function calls
-		 */
-		oldcontext = MemoryContextSwitchTo(funcctx->multi_call_memory_ctx);
-
-		/* allocate memory for user context */
-		fctx = (generate_series_fctx *) palloc(sizeof(generate_series_fctx));
-
-		/*
-		 * Use fctx to keep state from call to call. Seed current with the
-		 * original start value
-		 */
-		fctx->current = start;
-		fctx->finish = finish;
-		fctx->step = step;
-
-		funcctx->user_fctx = fctx;
-		MemoryContextSwitchTo(oldcontext);
-	}
-
-	/* stuff done on every call of the function */
-	funcctx = SRF_PERCALL_SETUP();
-
-	/*
-	 * get the saved state and use current as the result for this iteration
-	 */
-	fctx = funcctx->user_fctx;
-	result = fctx->current;
-
-	if ((fctx->step > 0 && fctx->current <= fctx->finish) ||
-		(fctx->step < 0 && fctx->current >= fctx->finish))
-	{
-		/* increment current in preparation for next iteration */
-		fctx->current += fctx->step;
-
-		/* if next-value computation overflows, this is the final result */
-		if ( (fctx->step > 0 && result > fctx->current) || (fctx->step < 0 && result < fctx->current))
-			fctx->step = 0;
+	uint32		arg1 = PG_GETARG_UINT32(0);
+	uint32		arg2 = PG_GETARG_UINT32(1);
 
-		/* do when there is more left to send */
-		SRF_RETURN_NEXT(funcctx, UInt32GetDatum(result));
-	}
+	if (arg1 > arg2)
+		PG_RETURN_INT32(1);
+	else if (arg1 < arg2)
+		PG_RETURN_INT32(-1);
 	else
-		/* do when there is no more left */
-		SRF_RETURN_DONE(funcctx);
+		PG_RETURN_INT32(0);
 }
 
-/* Comparators */
+/* Cross-type comparators, for the btree operator families */
 
-DECLARE(uint2_cmp)
+DECLARE(uint24_cmp)
 Datum
-uint2_cmp(PG_FUNCTION_ARGS)
+uint24_cmp(PG_FUNCTION_ARGS)
 {
 	uint16		arg1 = PG_GETARG_UINT16(0);
-	uint16		arg2 = PG_GETARG_UINT16(1);
+	uint32		arg2 = PG_GETARG_UINT32(1);
 
 	if (arg1 > arg2)
 		PG_RETURN_INT32(1);
@@ -1071,12 +1005,12 @@ uint2_cmp(PG_FUNCTION_ARGS)
 		PG_RETURN_INT32(0);
 }
 
-DECLARE(uint4_cmp)
+DECLARE(uint42_cmp)
 Datum
-uint4_cmp(PG_FUNCTION_ARGS)
+uint42_cmp(PG_FUNCTION_ARGS)
 {
 	uint32		arg1 = PG_GETARG_UINT32(0);
-	uint32		arg2 = PG_GETARG_UINT32(1);
+	uint16		arg2 = PG_GETARG_UINT16(1);
 
 	if (arg1 > arg2)
 		PG_RETURN_INT32(1);
@@ -1086,6 +1020,53 @@ uint4_cmp(PG_FUNCTION_ARGS)
 		PG_RETURN_INT32(0);
 }
 
+/*
+ * Sort support: plain C comparators, avoiding the fmgr call per comparison.
+ * The difference of two uint2 values always fits in an int.
+ */
+static int
+uint2_fastcmp(Datum x, Datum y, SortSupport ssup)
+{
+	uint16		a = DatumGetUInt16(x);
+	uint16		b = DatumGetUInt16(y);
+
+	return (int) a - (int) b;
+}
+
+DECLARE(uint2_sortsupport)
+Datum
+uint2_sortsupport(PG_FUNCTION_ARGS)
+{
+	SortSupport ssup = (SortSupport) PG_GETARG_POINTER(0);
+
+	ssup->comparator = uint2_fastcmp;
+	PG_RETURN_VOID();
+}
+
+static int
+uint4_fastcmp(Datum x, Datum y, SortSupport ssup)
+{
+	uint32		a = DatumGetUInt32(x);
+	uint32		b = DatumGetUInt32(y);
+
+	if (a > b)
+		return 1;
+	else if (a < b)
+		return -1;
+	else
+		return 0;
+}
+
+DECLARE(uint4_sortsupport)
+Datum
+uint4_sortsupport(PG_FUNCTION_ARGS)
+{
+	SortSupport ssup = (SortSupport) PG_GETARG_POINTER(0);
+
+	ssup->comparator = uint4_fastcmp;
+	PG_RETURN_VOID();
+}
+
 /* Hashes */
 
 DECLARE(uint4_hash)
@@ -1104,3 +1085,26 @@ uint2_hash(PG_FUNCTION_ARGS)
 
 	return DatumGetUInt32(hash_uint32((uint32)arg1));
 }
+
+/*
+ * Seeded 64-bit hashes, hash opclass support function 2.  They match
+ * hashint4extended and hashint2extended for the values the types share.
+ */
+
+DECLARE(uint4_hash_extended)
+Datum
+uint4_hash_extended(PG_FUNCTION_ARGS)
+{
+	uint32		arg1 = PG_GETARG_UINT32(0);
+
+	return hash_uint32_extended(arg1, PG_GETARG_INT64(1));
+}
+
+DECLARE(uint2_hash_extended)
+Datum
+uint2_hash_extended(PG_FUNCTION_ARGS)
+{
+	uint16		arg1 = PG_GETARG_UINT16(0);
+
+	return hash_uint32_extended((uint32) arg1, PG_GETARG_INT64(1));
+}
@@ -0,0 +1,472 @@
+/*-------------------------------------------------------------------------
+ *
+ * uint1.c
+ *	  Unsigned 8-bit integer operations
+ *
+ * Portions Copyright (c) 1996-2013, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include <limits.h>
+
+#include "access/hash.h"
+#include "utils/builtins.h"
+#include "utils/sortsupport.h"
+
+#include "declare.h"
+#include "uints_numutils.h"
+#include "uints_fmgr.h"
+#include "uints_pqformat.h"
+
+/*****************************************************************************
+ *	 USER I/O ROUTINES														 *
+ *****************************************************************************/
+
+/*
+ *		uint1in			- converts "num" to uint1
+ */
+DECLARE(uint1in)
+Datum
+uint1in(PG_FUNCTION_ARGS)
+{
+	char	   *num = PG_GETARG_CSTRING(0);
+
+	PG_RETURN_UINT8(pg_atou1(num, '\0'));
+}
+
+/*
+ *		uint1out			- converts uint1 to "num"
+ */
+DECLARE(uint1out)
+Datum
+uint1out(PG_FUNCTION_ARGS)
+{
+	uint8		arg1 = PG_GETARG_UINT8(0);
+	char	   *result = (char *) palloc(MAXUINT1LEN + 1);
+
+	pg_u1toa(arg1, result);
+	PG_RETURN_CSTRING(result);
+}
+
+/*
+ *		uint1recv			- converts external binary format to uint1
+ */
+DECLARE(uint1recv)
+Datum
+uint1recv(PG_FUNCTION_ARGS)
+{
+	StringInfo	buf = (StringInfo) PG_GETARG_POINTER(0);
+
+	PG_RETURN_UINT8(*(const uint8 *) uint_getmsgbytes(buf, sizeof(uint8)));
+}
+
+/*
+ *		uint1send			- converts uint1 to binary format
+ */
+DECLARE(uint1send)
+Datum
+uint1send(PG_FUNCTION_ARGS)
+{
+	uint8		arg1 = PG_GETARG_UINT8(0);
+
+	PG_RETURN_BYTEA_P(uint_sendbytes(&arg1, sizeof(arg1)));
+}
+
+
+/*
+ *		===================
+ *		CONVERSION ROUTINES
+ *		===================
+ */
+
+DECLARE(u1tou2)
+Datum
+u1tou2(PG_FUNCTION_ARGS)
+{
+	uint8		arg1 = PG_GETARG_UINT8(0);
+
+	PG_RETURN_UINT16((uint16) arg1);
+}
+
+DECLARE(u2tou1)
+Datum
+u2tou1(PG_FUNCTION_ARGS)
+{
+	uint16		arg1 = PG_GETARG_UINT16(0);
+
+	if (arg1 > UCHAR_MAX)
+		ereport(ERROR,
+				(errcode(ERRCODE_NUMERIC_VALUE_OUT_OF_RANGE),
+				 errmsg("uint1 out of range")));
+
+	PG_RETURN_UINT8((uint8) arg1);
+}
+
+DECLARE(u1tou4)
+Datum
+u1tou4(PG_FUNCTION_ARGS)
+{
+	uint8		arg1 = PG_GETARG_UINT8(0);
+
+	PG_RETURN_UINT32((uint32) arg1);
+}
+
+DECLARE(u4tou1)
+Datum
+u4tou1(PG_FUNCTION_ARGS)
+{
+	uint32		arg1 = PG_GETARG_UINT32(0);
+
+	if (arg1 > UCHAR_MAX)
+		ereport(ERROR,
+				(errcode(ERRCODE_NUMERIC_VALUE_OUT_OF_RANGE),
+				 errmsg("uint1 out of range")));
+
+	PG_RETURN_UINT8((uint8) arg1);
+}
+
+DECLARE(u1tou8)
+Datum
+u1tou8(PG_FUNCTION_ARGS)
+{
+	uint8		arg1 = PG_GETARG_UINT8(0);
+
+	PG_RETURN_UINT64((uint64) arg1);
+}
+
+DECLARE(u8tou1)
+Datum
+u8tou1(PG_FUNCTION_ARGS)
+{
+	uint64		arg1 = PG_GETARG_UINT64(0);
+
+	if (arg1 > UCHAR_MAX)
+		ereport(ERROR,
+				(errcode(ERRCODE_NUMERIC_VALUE_OUT_OF_RANGE),
+				 errmsg("uint1 out of range")));
+
+	PG_RETURN_UINT8((uint8) arg1);
+}
+
+/* Cast uint1 -> int4 */
+DECLARE(u1toi4)
+Datum
+u1toi4(PG_FUNCTION_ARGS)
+{
+	uint8		arg1 = PG_GETARG_UINT8(0);
+
+	PG_RETURN_INT32((int32) arg1);
+}
+
+/* Cast int4 -> uint1 */
+DECLARE(i4tou1)
+Datum
+i4tou1(PG_FUNCTION_ARGS)
+{
+	int32		arg1 = PG_GETARG_INT32(0);
+
+	if (arg1 < 0 || arg1 > UCHAR_MAX)
+		ereport(ERROR,
+			(errcode(ERRCODE_NUMERIC_VALUE_OUT_OF_RANGE),
+			errmsg("value %d is out of range for type uint1", arg1)));
+
+	PG_RETURN_UINT8((uint8) arg1);
+}
+
+/*
+ *		============================
+ *		COMPARISON OPERATOR ROUTINES
+ *		============================
+ */
+
+DECLARE(uint1eq)
+Datum
+uint1eq(PG_FUNCTION_ARGS)
+{
+	uint8		arg1 = PG_GETARG_UINT8(0);
+	uint8		arg2 = PG_GETARG_UINT8(1);
+
+	PG_RETURN_BOOL(arg1 == arg2);
+}
+
+DECLARE(uint1ne)
+Datum
+uint1ne(PG_FUNCTION_ARGS)
+{
+	uint8		arg1 = PG_GETARG_UINT8(0);
+	uint8		arg2 = PG_GETARG_UINT8(1);
+
+	PG_RETURN_BOOL(arg1 != arg2);
+}
+
+DECLARE(uint1lt)
+Datum
+uint1lt(PG_FUNCTION_ARGS)
+{
+	uint8		arg1 = PG_GETARG_UINT8(0);
+	uint8		arg2 = PG_GETARG_UINT8(1);
+
+	PG_RETURN_BOOL(arg1 < arg2);
+}
+
+DECLARE(uint1le)
+Datum
+uint1le(PG_FUNCTION_ARGS)
+{
+	uint8		arg1 = PG_GETARG_UINT8(0);
+	uint8		arg2 = PG_GETARG_UINT8(1);
+
+	PG_RETURN_BOOL(arg1 <= arg2);
+}
+
+DECLARE(uint1gt)
+Datum
+uint1gt(PG_FUNCTION_ARGS)
+{
+	uint8		arg1 = PG_GETARG_UINT8(0);
+	uint8		arg2 = PG_GETARG_UINT8(1);
+
+	PG_RETURN_BOOL(arg1 > arg2);
+}
+
+DECLARE(uint1ge)
+Datum
+uint1ge(PG_FUNCTION_ARGS)
+{
+	uint8		arg1 = PG_GETARG_UINT8(0);
+	uint8		arg2 = PG_GETARG_UINT8(1);
+
+	PG_RETURN_BOOL(arg1 >= arg2);
+}
+
+/*
+ *		uint1pl		- returns arg1 + arg2
+ *		uint1mi		- returns arg1 - arg2
+ *		uint1mul		- returns arg1 * arg2
+ *		uint1div		- returns arg1 / arg2
+ *		uint1mod		- returns arg1 % arg2
+ */
+
+DECLARE(uint1pl)
+Datum
+uint1pl(PG_FUNCTION_ARGS)
+{
+	uint8		arg1 = PG_GETARG_UINT8(0);
+	uint8		arg2 = PG_GETARG_UINT8(1);
+
+	/* Overflow check */
+	if (arg1 > UCHAR_MAX - arg2)
+		report_out_of_range();
+
+	PG_RETURN_UINT8(arg1 + arg2);
+}
+
+DECLARE(uint1mi)
+Datum
+uint1mi(PG_FUNCTION_ARGS)
+{
+	uint8		arg1 = PG_GETARG_UINT8(0);
+	uint8		arg2 = PG_GETARG_UINT8(1);
+
+	/* Overflow check */
+	if (arg2 > arg1)
+		report_out_of_range();
+
+	PG_RETURN_UINT8(arg1 - arg2);
+}
+
+DECLARE(uint1mul)
+Datum
+uint1mul(PG_FUNCTION_ARGS)
+{
+	uint8		arg1 = PG_GETARG_UINT8(0);
+	uint8		arg2 = PG_GETARG_UINT8(1);
+	uint32		result;
+
+	/* The product of two bytes always fits in 32 bits */
+	result = (uint32) arg1 * (uint32) arg2;
+
+	if (result > UCHAR_MAX)
+		report_out_of_range();
+
+	PG_RETURN_UINT8((uint8) result);
+}
+
+DECLARE(uint1div)
+Datum
+uint1div(PG_FUNCTION_ARGS)
+{
+	uint8		arg1 = PG_GETARG_UINT8(0);
+	uint8		arg2 = PG_GETARG_UINT8(1);
+
+	if (arg2 == 0)
+		report_division_by_zero();
+
+	/* No overflow is possible */
+	PG_RETURN_UINT8(arg1 / arg2);
+}
+
+DECLARE(uint1mod)
+Datum
+uint1mod(PG_FUNCTION_ARGS)
+{
+	uint8		arg1 = PG_GETARG_UINT8(0);
+	uint8		arg2 = PG_GETARG_UINT8(1);
+
+	if (arg2 == 0)
+		report_division_by_zero();
+
+	/* No overflow is possible */
+	PG_RETURN_UINT8(arg1 % arg2);
+}
+
+DECLARE(uint1larger)
+Datum
+uint1larger(PG_FUNCTION_ARGS)
+{
+	uint8		arg1 = PG_GETARG_UINT8(0);
+	uint8		arg2 = PG_GETARG_UINT8(1);
+
+	PG_RETURN_UINT8((arg1 > arg2) ? arg1 : arg2);
+}
+
+DECLARE(uint1smaller)
+Datum
+uint1smaller(PG_FUNCTION_ARGS)
+{
+	uint8		arg1 = PG_GETARG_UINT8(0);
+	uint8		arg2 = PG_GETARG_UINT8(1);
+
+	PG_RETURN_UINT8((arg1 < arg2) ? arg1 : arg2);
+}
+
+/*
+ * Bit-pushing operators
+ *
+ *		uint1and		- returns arg1 & arg2
+ *		uint1or		- returns arg1 | arg2
+ *		uint1xor		- returns arg1 # arg2
+ *		uint1not		- returns ~arg1
+ *		uint1shl		- returns arg1 << arg2
+ *		uint1shr		- returns arg1 >> arg2
+ */
+
+DECLARE(uint1and)
+Datum
+uint1and(PG_FUNCTION_ARGS)
+{
+	uint8		arg1 = PG_GETARG_UINT8(0);
+	uint8		arg2 = PG_GETARG_UINT8(1);
+
+	PG_RETURN_UINT8(arg1 & arg2);
+}
+
+DECLARE(uint1or)
+Datum
+uint1or(PG_FUNCTION_ARGS)
+{
+	uint8		arg1 = PG_GETARG_UINT8(0);
+	uint8		arg2 = PG_GETARG_UINT8(1);
+
+	PG_RETURN_UINT8(arg1 | arg2);
+}
+
+DECLARE(uint1xor)
+Datum
+uint1xor(PG_FUNCTION_ARGS)
+{
+	uint8		arg1 = PG_GETARG_UINT8(0);
+	uint8		arg2 = PG_GETARG_UINT8(1);
+
+	PG_RETURN_UINT8(arg1 ^ arg2);
+}
+
+DECLARE(uint1not)
+Datum
+uint1not(PG_FUNCTION_ARGS)
+{
+	uint8		arg1 = PG_GETARG_UINT8(0);
+
+	PG_RETURN_UINT8((uint8) ~arg1);
+}
+
+DECLARE(uint1shl)
+Datum
+uint1shl(PG_FUNCTION_ARGS)
+{
+	uint8		arg1 = PG_GETARG_UINT8(0);
+	int32		arg2 = PG_GETARG_INT32(1);
+
+	PG_RETURN_UINT8((uint8) (arg1 << arg2));
+}
+
+DECLARE(uint1shr)
+Datum
+uint1shr(PG_FUNCTION_ARGS)
+{
+	uint8		arg1 = PG_GETARG_UINT8(0);
+	int32		arg2 = PG_GETARG_INT32(1);
+
+	PG_RETURN_UINT8(arg1 >> arg2);
+}
+
+/* Comparators */
+
+DECLARE(uint1_cmp)
+Datum
+uint1_cmp(PG_FUNCTION_ARGS)
+{
+	uint8		arg1 = PG_GETARG_UINT8(0);
+	uint8		arg2 = PG_GETARG_UINT8(1);
+
+	if (arg1 > arg2)
+		PG_RETURN_INT32(1);
+	else if (arg1 < arg2)
+		PG_RETURN_INT32(-1);
+	else
+		PG_RETURN_INT32(0);
+}
+
+/* Sort support: the difference of two uint1 values always fits in an int */
+static int
+uint1_fastcmp(Datum x, Datum y, SortSupport ssup)
+{
+	uint8		a = DatumGetUInt8(x);
+	uint8		b = DatumGetUInt8(y);
+
+	return (int) a - (int) b;
+}
+
+DECLARE(uint1_sortsupport)
+Datum
+uint1_sortsupport(PG_FUNCTION_ARGS)
+{
+	SortSupport ssup = (SortSupport) PG_GETARG_POINTER(0);
+
+	ssup->comparator = uint1_fastcmp;
+	PG_RETURN_VOID();
+}
+
+/* Hashes */
+
+DECLARE(uint1_hash)
+Datum
+uint1_hash(PG_FUNCTION_ARGS)
+{
+	uint8		arg1 = PG_GETARG_UINT8(0);
+
+	PG_RETURN_UINT32(hash_uint32((uint32) arg1));
+}
+
+DECLARE(uint1_hash_extended)
+Datum
+uint1_hash_extended(PG_FUNCTION_ARGS)
+{
+	uint8		arg1 = PG_GETARG_UINT8(0);
+
+	return hash_uint32_extended((uint32) arg1, PG_GETARG_INT64(1));
+}
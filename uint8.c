@@ -15,21 +15,15 @@
 #include <limits.h>
 #include <math.h>
 
-#include "funcapi.h"
-#include "libpq/pqformat.h"
-#include "utils/int8.h"
+#include "access/hash.h"
 #include "utils/builtins.h"
+#include "utils/numeric.h"
+#include "utils/sortsupport.h"
 
 #include "declare.h"
 #include "uints_numutils.h"
 #include "uints_fmgr.h"
-
-typedef struct
-{
-	uint64		current;
-	uint64		finish;
-	uint64		step;
-} generate_series_fctx;
+#include "uints_pqformat.h"
 
 
 /***********************************************************************
@@ -42,8 +36,6 @@ typedef struct
  * Formatting and conversion routines.
  *---------------------------------------------------------*/
 
-#define MAXINT8LEN 25
-
 /* uint8in()
  */
 DECLARE(uint8in)
@@ -62,11 +54,9 @@ Datum
 uint8out(PG_FUNCTION_ARGS)
 {
 	uint64		val = PG_GETARG_UINT64(0);
-	char		buf[MAXINT8LEN + 1];
-	char	   *result;
+	char	   *result = (char *) palloc(MAXUINT8LEN + 1);
 
-	pg_u8toa(val, buf);
-	result = pstrdup(buf);
+	pg_u8toa(val, result);
 	PG_RETURN_CSTRING(result);
 }
 
@@ -79,7 +69,7 @@ uint8recv(PG_FUNCTION_ARGS)
 {
 	StringInfo	buf = (StringInfo) PG_GETARG_POINTER(0);
 
-	PG_RETURN_UINT64((uint64) pq_getmsgint64(buf));
+	PG_RETURN_UINT64(uint_getmsg64(buf));
 }
 
 /*
@@ -89,12 +79,9 @@ DECLARE(uint8send)
 Datum
 uint8send(PG_FUNCTION_ARGS)
 {
-	uint64		arg1 = PG_GETARG_UINT64(0);
-	StringInfoData buf;
+	uint64		n = pg_hton64(PG_GETARG_UINT64(0));
 
-	pq_begintypsend(&buf);
-	pq_sendint64(&buf, (uint64)arg1);
-	PG_RETURN_BYTEA_P(pq_endtypsend(&buf));
+	PG_RETURN_BYTEA_P(uint_sendbytes(&n, sizeof(n)));
 }
 
 
@@ -740,7 +727,7 @@ uint82mi(PG_FUNCTION_ARGS)
 	uint64		arg1 = PG_GETARG_UINT64(0);
 	uint16		arg2 = PG_GETARG_UINT16(1);
 
-	if (arg2 - arg1)
+	if (arg2 > arg1)
 		report_out_of_range();
 
 	PG_RETURN_UINT64(arg1 - arg2);
@@ -774,53 +761,34 @@ uint82div(PG_FUNCTION_ARGS)
 
 	PG_RETURN_UINT64(arg1 / arg2);
 }
-# if 0
 
-DECLARE(xxx)
+DECLARE(uint28pl)
 Datum
 uint28pl(PG_FUNCTION_ARGS)
 {
 	uint16		arg1 = PG_GETARG_UINT16(0);
 	uint64		arg2 = PG_GETARG_UINT64(1);
-	uint64		result;
 
-	result = arg1 + arg2;
+	if (arg2 > ULONG_LONG_MAX - arg1)
+		report_out_of_range();
 
-	/*
-	 * Overflow check.	If the inputs are of different signs then their sum
-	 * cannot overflow.  If the inputs are of the same sign, their sum had
-	 * better be that sign too.
-	 */
-	if (SAMESIGN(arg1, arg2) && !SAMESIGN(result, arg1))
-		ereport(ERROR,
-				(errcode(ERRCODE_NUMERIC_VALUE_OUT_OF_RANGE),
-				 errmsg("bigint out of range")));
-	PG_RETURN_UINT64(result);
+	PG_RETURN_UINT64(arg1 + arg2);
 }
 
-DECLARE(xxx)
+DECLARE(uint28mi)
 Datum
 uint28mi(PG_FUNCTION_ARGS)
 {
 	uint16		arg1 = PG_GETARG_UINT16(0);
 	uint64		arg2 = PG_GETARG_UINT64(1);
-	uint64		result;
 
-	result = arg1 - arg2;
+	if (arg2 > arg1)
+		report_out_of_range();
 
-	/*
-	 * Overflow check.	If the inputs are of the same sign then their
-	 * difference cannot overflow.	If they are of different signs then the
-	 * result should be of the same sign as the first input.
-	 */
-	if (!SAMESIGN(arg1, arg2) && !SAMESIGN(result, arg1))
-		ereport(ERROR,
-				(errcode(ERRCODE_NUMERIC_VALUE_OUT_OF_RANGE),
-				 errmsg("bigint out of range")));
-	PG_RETURN_UINT64(result);
+	PG_RETURN_UINT64(arg1 - arg2);
 }
 
-DECLARE(xxx)
+DECLARE(uint28mul)
 Datum
 uint28mul(PG_FUNCTION_ARGS)
 {
@@ -831,24 +799,17 @@ uint28mul(PG_FUNCTION_ARGS)
 	result = arg1 * arg2;
 
 	/*
-	 * Overflow check.	We basically check to see if result / arg2 gives arg1
-	 * again.  There is one case where this fails: arg2 = 0 (which cannot
-	 * overflow).
-	 *
-	 * Since the division is likely much more expensive than the actual
-	 * multiplication, we'd like to skip it where possible.  The best bang for
-	 * the buck seems to be to check whether both inputs are in the uint32
-	 * range; if so, no overflow is possible.
+	 * Overflow check.	If arg2 fits in uint32, the product of a 16-bit and a
+	 * 32-bit value cannot overflow 64 bits.  Otherwise arg2 is non-zero, so
+	 * dividing the result back is safe.
 	 */
-	if (arg2 != (uint64) ((uint32) arg2) &&
-		result / arg2 != arg1)
-		ereport(ERROR,
-				(errcode(ERRCODE_NUMERIC_VALUE_OUT_OF_RANGE),
-				 errmsg("bigint out of range")));
+	if (arg2 > UINT_MAX && result / arg2 != arg1)
+		report_out_of_range();
+
 	PG_RETURN_UINT64(result);
 }
 
-DECLARE(xxx)
+DECLARE(uint28div)
 Datum
 uint28div(PG_FUNCTION_ARGS)
 {
@@ -856,13 +817,7 @@ uint28div(PG_FUNCTION_ARGS)
 	uint64		arg2 = PG_GETARG_UINT64(1);
 
 	if (arg2 == 0)
-	{
-		ereport(ERROR,
-				(errcode(ERRCODE_DIVISION_BY_ZERO),
-				 errmsg("division by zero")));
-		/* ensure compiler realizes we mustn't reach the division (gcc bug) */
-		PG_RETURN_NULL();
-	}
+		report_division_by_zero();
 
 	/* No overflow is possible */
 	PG_RETURN_UINT64((uint64) arg1 / arg2);
@@ -870,15 +825,15 @@ uint28div(PG_FUNCTION_ARGS)
 
 /* Binary arithmetics
  *
- *		int8and		- returns arg1 & arg2
- *		int8or		- returns arg1 | arg2
- *		int8xor		- returns arg1 # arg2
- *		int8not		- returns ~arg1
- *		int8shl		- returns arg1 << arg2
- *		int8shr		- returns arg1 >> arg2
+ *		uint8and		- returns arg1 & arg2
+ *		uint8or		- returns arg1 | arg2
+ *		uint8xor		- returns arg1 # arg2
+ *		uint8not		- returns ~arg1
+ *		uint8shl		- returns arg1 << arg2
+ *		uint8shr		- returns arg1 >> arg2
  */
 
-DECLARE(xxx)
+DECLARE(uint8and)
 Datum
 uint8and(PG_FUNCTION_ARGS)
 {
@@ -888,7 +843,7 @@ uint8and(PG_FUNCTION_ARGS)
 	PG_RETURN_UINT64(arg1 & arg2);
 }
 
-DECLARE(xxx)
+DECLARE(uint8or)
 Datum
 uint8or(PG_FUNCTION_ARGS)
 {
@@ -898,7 +853,7 @@ uint8or(PG_FUNCTION_ARGS)
 	PG_RETURN_UINT64(arg1 | arg2);
 }
 
-DECLARE(xxx)
+DECLARE(uint8xor)
 Datum
 uint8xor(PG_FUNCTION_ARGS)
 {
@@ -908,7 +863,7 @@ uint8xor(PG_FUNCTION_ARGS)
 	PG_RETURN_UINT64(arg1 ^ arg2);
 }
 
-DECLARE(xxx)
+DECLARE(uint8not)
 Datum
 uint8not(PG_FUNCTION_ARGS)
 {
@@ -917,22 +872,22 @@ uint8not(PG_FUNCTION_ARGS)
 	PG_RETURN_UINT64(~arg1);
 }
 
-DECLARE(xxx)
+DECLARE(uint8shl)
 Datum
 uint8shl(PG_FUNCTION_ARGS)
 {
 	uint64		arg1 = PG_GETARG_UINT64(0);
-	uint32		arg2 = PG_GETARG_UINT32(1);
+	int32		arg2 = PG_GETARG_INT32(1);
 
 	PG_RETURN_UINT64(arg1 << arg2);
 }
 
-DECLARE(xxx)
+DECLARE(uint8shr)
 Datum
 uint8shr(PG_FUNCTION_ARGS)
 {
 	uint64		arg1 = PG_GETARG_UINT64(0);
-	uint32		arg2 = PG_GETARG_UINT32(1);
+	int32		arg2 = PG_GETARG_INT32(1);
 
 	PG_RETURN_UINT64(arg1 >> arg2);
 }
@@ -941,63 +896,55 @@ uint8shr(PG_FUNCTION_ARGS)
  *	Conversion operators.
  *---------------------------------------------------------*/
 
-DECLARE(xxx)
+DECLARE(u4tou8)
 Datum
-uint48(PG_FUNCTION_ARGS)
+u4tou8(PG_FUNCTION_ARGS)
 {
 	uint32		arg = PG_GETARG_UINT32(0);
 
 	PG_RETURN_UINT64((uint64) arg);
 }
 
-DECLARE(xxx)
+DECLARE(u8tou4)
 Datum
-uint84(PG_FUNCTION_ARGS)
+u8tou4(PG_FUNCTION_ARGS)
 {
 	uint64		arg = PG_GETARG_UINT64(0);
-	uint32		result;
-
-	result = (uint32) arg;
 
-	/* Test for overflow by reverse-conversion. */
-	if ((uint64) result != arg)
+	if (arg > UINT_MAX)
 		ereport(ERROR,
 				(errcode(ERRCODE_NUMERIC_VALUE_OUT_OF_RANGE),
-				 errmsg("integer out of range")));
+				 errmsg("uint4 out of range")));
 
-	PG_RETURN_INT32(result);
+	PG_RETURN_UINT32((uint32) arg);
 }
 
-DECLARE(xxx)
+DECLARE(u2tou8)
 Datum
-uint28(PG_FUNCTION_ARGS)
+u2tou8(PG_FUNCTION_ARGS)
 {
 	uint16		arg = PG_GETARG_UINT16(0);
 
 	PG_RETURN_UINT64((uint64) arg);
 }
 
-DECLARE(xxx)
+DECLARE(u8tou2)
 Datum
-uint82(PG_FUNCTION_ARGS)
+u8tou2(PG_FUNCTION_ARGS)
 {
 	uint64		arg = PG_GETARG_UINT64(0);
-	uint16		result;
 
-	result = (uint16) arg;
-
-	/* Test for overflow by reverse-conversion. */
-	if ((uint64) result != arg)
+	if (arg > USHRT_MAX)
 		ereport(ERROR,
 				(errcode(ERRCODE_NUMERIC_VALUE_OUT_OF_RANGE),
-				 errmsg("smallint out of range")));
+				 errmsg("uint2 out of range")));
 
-	PG_RETURN_INT16(result);
+	PG_RETURN_UINT16((uint16) arg);
 }
 
-DECLARE(xxx)
+DECLARE(u8tod)
 Datum
-i8tod(PG_FUNCTION_ARGS)
+u8tod(PG_FUNCTION_ARGS)
 {
 	uint64		arg = PG_GETARG_UINT64(0);
 	float8		result;
@@ -1007,34 +954,216 @@ i8tod(PG_FUNCTION_ARGS)
 	PG_RETURN_FLOAT8(result);
 }
 
-/* dtoi8()
- * Convert float8 to 8-byte integer.
+/* dtou8()
+ * Convert float8 to unsigned 8-byte integer.
  */
-DECLARE(xxx)
+DECLARE(dtou8)
 Datum
-dtoi8(PG_FUNCTION_ARGS)
+dtou8(PG_FUNCTION_ARGS)
 {
 	float8		arg = PG_GETARG_FLOAT8(0);
-	uint64		result;
 
 	/* Round arg to nearest integer (but it's still in float form) */
 	arg = rint(arg);
 
 	/*
-	 * Does it fit in an uint64?  Avoid assuming that we have handy constants
-	 * defined for the range boundaries, instead test for overflow by
-	 * reverse-conversion.
+	 * Converting an out-of-range float to an unsigned integer is undefined,
+	 * so test the range first.  2^64 is exactly representable as a float8.
 	 */
-	result = (uint64) arg;
+	if (isnan(arg) || arg < 0.0 || arg >= 18446744073709551616.0)
+		ereport(ERROR,
+				(errcode(ERRCODE_NUMERIC_VALUE_OUT_OF_RANGE),
+				 errmsg("uint8 out of range")));
 
-	if ((float8) result != arg)
+	PG_RETURN_UINT64((uint64) arg);
+}
+
+/* u8tonumeric()
+ * Convert uint8 to numeric.  There is no numeric constructor taking an
+ * unsigned 64-bit value, so go through the text representation.
+ */
+DECLARE(u8tonumeric)
+Datum
+u8tonumeric(PG_FUNCTION_ARGS)
+{
+	uint64		arg = PG_GETARG_UINT64(0);
+	char		buf[MAXUINT8LEN + 1];
+
+	pg_u8toa(arg, buf);
+
+	PG_RETURN_DATUM(DirectFunctionCall3(numeric_in,
+										CStringGetDatum(buf),
+										ObjectIdGetDatum(InvalidOid),
+										Int32GetDatum(-1)));
+}
+
+/* numerictou8()
+ * Convert numeric to uint8, rounding to the nearest integer.
+ */
+DECLARE(numerictou8)
+Datum
+numerictou8(PG_FUNCTION_ARGS)
+{
+	Numeric		num = PG_GETARG_NUMERIC(0);
+	Datum		rounded;
+	char	   *str;
+
+	if (numeric_is_nan(num))
+		ereport(ERROR,
+				(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+				 errmsg("cannot convert NaN to uint8")));
+
+	rounded = DirectFunctionCall2(numeric_round,
+								  NumericGetDatum(num),
+								  Int32GetDatum(0));
+	str = DatumGetCString(DirectFunctionCall1(numeric_out, rounded));
+
+	if (str[0] == '-')
 		ereport(ERROR,
 				(errcode(ERRCODE_NUMERIC_VALUE_OUT_OF_RANGE),
-				 errmsg("bigint out of range")));
+				 errmsg("uint8 out of range")));
 
-	PG_RETURN_UINT64(result);
+	PG_RETURN_UINT64(pg_atou8(str, '\0'));
+}
+
+/* Comparators */
+
+DECLARE(uint8_cmp)
+Datum
+uint8_cmp(PG_FUNCTION_ARGS)
+{
+	uint64		arg1 = PG_GETARG_UINT64(0);
+	uint64		arg2 = PG_GETARG_UINT64(1);
+
+	if (arg1 > arg2)
+		PG_RETURN_INT32(1);
+	else if (arg1 < arg2)
+		PG_RETURN_INT32(-1);
+	else
+		PG_RETURN_INT32(0);
+}
+
+DECLARE(uint84_cmp)
+Datum
+uint84_cmp(PG_FUNCTION_ARGS)
+{
+	uint64		arg1 = PG_GETARG_UINT64(0);
+	uint32		arg2 = PG_GETARG_UINT32(1);
+
+	if (arg1 > arg2)
+		PG_RETURN_INT32(1);
+	else if (arg1 < arg2)
+		PG_RETURN_INT32(-1);
+	else
+		PG_RETURN_INT32(0);
+}
+
+DECLARE(uint48_cmp)
+Datum
+uint48_cmp(PG_FUNCTION_ARGS)
+{
+	uint32		arg1 = PG_GETARG_UINT32(0);
+	uint64		arg2 = PG_GETARG_UINT64(1);
+
+	if (arg1 > arg2)
+		PG_RETURN_INT32(1);
+	else if (arg1 < arg2)
+		PG_RETURN_INT32(-1);
+	else
+		PG_RETURN_INT32(0);
 }
 
+DECLARE(uint82_cmp)
+Datum
+uint82_cmp(PG_FUNCTION_ARGS)
+{
+	uint64		arg1 = PG_GETARG_UINT64(0);
+	uint16		arg2 = PG_GETARG_UINT16(1);
+
+	if (arg1 > arg2)
+		PG_RETURN_INT32(1);
+	else if (arg1 < arg2)
+		PG_RETURN_INT32(-1);
+	else
+		PG_RETURN_INT32(0);
+}
+
+DECLARE(uint28_cmp)
+Datum
+uint28_cmp(PG_FUNCTION_ARGS)
+{
+	uint16		arg1 = PG_GETARG_UINT16(0);
+	uint64		arg2 = PG_GETARG_UINT64(1);
+
+	if (arg1 > arg2)
+		PG_RETURN_INT32(1);
+	else if (arg1 < arg2)
+		PG_RETURN_INT32(-1);
+	else
+		PG_RETURN_INT32(0);
+}
+
+/* Sort support: a plain C comparator, avoiding the fmgr call */
+static int
+uint8_fastcmp(Datum x, Datum y, SortSupport ssup)
+{
+	uint64		a = DatumGetUInt64(x);
+	uint64		b = DatumGetUInt64(y);
+
+	if (a > b)
+		return 1;
+	else if (a < b)
+		return -1;
+	else
+		return 0;
+}
+
+DECLARE(uint8_sortsupport)
+Datum
+uint8_sortsupport(PG_FUNCTION_ARGS)
+{
+	SortSupport ssup = (SortSupport) PG_GETARG_POINTER(0);
+
+	ssup->comparator = uint8_fastcmp;
+	PG_RETURN_VOID();
+}
+
+/* Hashes */
+
+DECLARE(uint8_hash)
+Datum
+uint8_hash(PG_FUNCTION_ARGS)
+{
+	uint64		val = PG_GETARG_UINT64(0);
+	uint32		lohalf = (uint32) val;
+	uint32		hihalf = (uint32) (val >> 32);
+
+	/*
+	 * Fold the high half into the low half, as hashint8 does for
+	 * non-negative values.  Values that fit in 32 bits then hash the same
+	 * as they do with uint4_hash.
+	 */
+	lohalf ^= hihalf;
+
+	PG_RETURN_UINT32(hash_uint32(lohalf));
+}
+
+DECLARE(uint8_hash_extended)
+Datum
+uint8_hash_extended(PG_FUNCTION_ARGS)
+{
+	uint64		val = PG_GETARG_UINT64(0);
+	uint32		lohalf = (uint32) val;
+	uint32		hihalf = (uint32) (val >> 32);
+
+	/* the same folding as uint8_hash, to match hashint8extended */
+	lohalf ^= hihalf;
+
+	return hash_uint32_extended(lohalf, PG_GETARG_INT64(1));
+}
+
+#if 0
+
 DECLARE(xxx)
 Datum
 i8tof(PG_FUNCTION_ARGS)
@@ -1103,87 +1232,4 @@ oidtoi8(PG_FUNCTION_ARGS)
 	PG_RETURN_UINT64((uint64) arg);
 }
 
-/*
- * non-persistent numeric series generator
- */
-DECLARE(xxx)
-Datum
-generate_series_int8(PG_FUNCTION_ARGS)
-{
-	return generate_series_step_int8(fcinfo);
-}
-
-DECLARE(xxx)
-Datum
-generate_series_step_int8(PG_FUNCTION_ARGS)
-{
-	FuncCallContext *funcctx;
-	generate_series_fctx *fctx;
-	uint64		result;
-	MemoryContext oldcontext;
-
-	/* stuff done only on the first call of the function */
-	if (SRF_IS_FIRSTCALL())
-	{
-		uint64		start = PG_GETARG_UINT64(0);
-		uint64		finish = PG_GETARG_UINT64(1);
-		uint64		step = 1;
-
-		/* see if we were given an explicit step size */
-		if (PG_NARGS() == 3)
-			step = PG_GETARG_UINT64(2);
-		if (step == 0)
-			ereport(ERROR,
-					(errcode(ERRCODE_INVALID_PARAMETER_VALUE),
-					 errmsg("step size cannot equal zero")));
-
-		/* create a function context for cross-call persistence */
-		funcctx = SRF_FIRSTCALL_INIT();
-
-		/*
-		 * switch to memory context appropriate for multiple function calls
-		 */
-		oldcontext = MemoryContextSwitchTo(funcctx->multi_call_memory_ctx);
-
-		/* allocate memory for user context */
-		fctx = (generate_series_fctx *) palloc(sizeof(generate_series_fctx));
-
-		/*
-		 * Use fctx to keep state from call to call. Seed current with the
-		 * original start value
-		 */
-		fctx->current = start;
-		fctx->finish = finish;
-		fctx->step = step;
-
-		funcctx->user_fctx = fctx;
-		MemoryContextSwitchTo(oldcontext);
-	}
-
-	/* stuff done on every call of the function */
-	funcctx = SRF_PERCALL_SETUP();
-
-	/*
-	 * get the saved state and use current as the result for this iteration
-	 */
-	fctx = funcctx->user_fctx;
-	result = fctx->current;
-
-	if ((fctx->step > 0 && fctx->current <= fctx->finish) ||
-		(fctx->step < 0 && fctx->current >= fctx->finish))
-	{
-		/* increment current in preparation for next iteration */
-		fctx->current += fctx->step;
-
-		/* if next-value computation overflows, this is the final result */
-		if (SAMESIGN(result, fctx->step) && !SAMESIGN(result, fctx->current))
-			fctx->step = 0;
-
-		/* do when there is more left to send */
-		SRF_RETURN_NEXT(funcctx, Int64GetDatum(result));
-	}
-	else
-		/* do when there is no more left */
-		SRF_RETURN_DONE(funcctx);
-}
 #endif
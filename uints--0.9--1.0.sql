@@ -0,0 +1,6057 @@
+/* uints--0.9--1.0.sql */
+
+-- complain if script is sourced in psql, rather than via ALTER EXTENSION
+\echo Use "ALTER EXTENSION uints UPDATE TO '1.0'" to load this file. \quit
+
+
+-- None of the 0.9 functions touch shared state, so all are parallel safe.
+
+ALTER FUNCTION uint2in(cstring) PARALLEL SAFE;
+ALTER FUNCTION uint2out(uint2) PARALLEL SAFE;
+ALTER FUNCTION uint2recv(internal) PARALLEL SAFE;
+ALTER FUNCTION uint2send(uint2) PARALLEL SAFE;
+ALTER FUNCTION uint4in(cstring) PARALLEL SAFE;
+ALTER FUNCTION uint4out(uint4) PARALLEL SAFE;
+ALTER FUNCTION uint4recv(internal) PARALLEL SAFE;
+ALTER FUNCTION uint4send(uint4) PARALLEL SAFE;
+ALTER FUNCTION u2tou4(uint2) PARALLEL SAFE;
+ALTER FUNCTION u4tou2(uint4) PARALLEL SAFE;
+ALTER FUNCTION uint4_bool(uint4) PARALLEL SAFE;
+ALTER FUNCTION bool_uint4(BOOLEAN) PARALLEL SAFE;
+ALTER FUNCTION i4tou2(int4) PARALLEL SAFE;
+ALTER FUNCTION uint4eq(uint4, uint4) PARALLEL SAFE;
+ALTER FUNCTION uint4ne(uint4, uint4) PARALLEL SAFE;
+ALTER FUNCTION uint4lt(uint4, uint4) PARALLEL SAFE;
+ALTER FUNCTION uint4le(uint4, uint4) PARALLEL SAFE;
+ALTER FUNCTION uint4gt(uint4, uint4) PARALLEL SAFE;
+ALTER FUNCTION uint4ge(uint4, uint4) PARALLEL SAFE;
+ALTER FUNCTION uint2eq(uint2, uint2) PARALLEL SAFE;
+ALTER FUNCTION uint2ne(uint2, uint2) PARALLEL SAFE;
+ALTER FUNCTION uint2lt(uint2, uint2) PARALLEL SAFE;
+ALTER FUNCTION uint2le(uint2, uint2) PARALLEL SAFE;
+ALTER FUNCTION uint2gt(uint2, uint2) PARALLEL SAFE;
+ALTER FUNCTION uint2ge(uint2, uint2) PARALLEL SAFE;
+ALTER FUNCTION uint24eq(uint2, uint4) PARALLEL SAFE;
+ALTER FUNCTION uint24ne(uint2, uint4) PARALLEL SAFE;
+ALTER FUNCTION uint24lt(uint2, uint4) PARALLEL SAFE;
+ALTER FUNCTION uint24le(uint2, uint4) PARALLEL SAFE;
+ALTER FUNCTION uint24gt(uint2, uint4) PARALLEL SAFE;
+ALTER FUNCTION uint24ge(uint2, uint4) PARALLEL SAFE;
+ALTER FUNCTION uint42eq(uint4, uint2) PARALLEL SAFE;
+ALTER FUNCTION uint42ne(uint4, uint2) PARALLEL SAFE;
+ALTER FUNCTION uint42lt(uint4, uint2) PARALLEL SAFE;
+ALTER FUNCTION uint42le(uint4, uint2) PARALLEL SAFE;
+ALTER FUNCTION uint42gt(uint4, uint2) PARALLEL SAFE;
+ALTER FUNCTION uint42ge(uint4, uint2) PARALLEL SAFE;
+ALTER FUNCTION uint4pl(uint4, uint4) PARALLEL SAFE;
+ALTER FUNCTION uint4mi(uint4, uint4) PARALLEL SAFE;
+ALTER FUNCTION uint4mul(uint4, uint4) PARALLEL SAFE;
+ALTER FUNCTION uint4div(uint4, uint4) PARALLEL SAFE;
+ALTER FUNCTION uint4inc(uint4) PARALLEL SAFE;
+ALTER FUNCTION uint2pl(uint2, uint2) PARALLEL SAFE;
+ALTER FUNCTION uint2mi(uint2, uint2) PARALLEL SAFE;
+ALTER FUNCTION uint2mul(uint2, uint2) PARALLEL SAFE;
+ALTER FUNCTION uint2div(uint2, uint2) PARALLEL SAFE;
+ALTER FUNCTION uint24pl(uint2, uint4) PARALLEL SAFE;
+ALTER FUNCTION uint24mi(uint2, uint4) PARALLEL SAFE;
+ALTER FUNCTION uint24mul(uint2, uint4) PARALLEL SAFE;
+ALTER FUNCTION uint24div(uint2, uint4) PARALLEL SAFE;
+ALTER FUNCTION uint42pl(uint4, uint2) PARALLEL SAFE;
+ALTER FUNCTION uint42mi(uint4, uint2) PARALLEL SAFE;
+ALTER FUNCTION uint42mul(uint4, uint2) PARALLEL SAFE;
+ALTER FUNCTION uint42div(uint4, uint2) PARALLEL SAFE;
+ALTER FUNCTION uint4mod(uint4, uint4) PARALLEL SAFE;
+ALTER FUNCTION uint2mod(uint2, uint2) PARALLEL SAFE;
+ALTER FUNCTION uint2larger(uint2, uint2) PARALLEL SAFE;
+ALTER FUNCTION uint2smaller(uint2, uint2) PARALLEL SAFE;
+ALTER FUNCTION uint4larger(uint4, uint4) PARALLEL SAFE;
+ALTER FUNCTION uint4smaller(uint4, uint4) PARALLEL SAFE;
+ALTER FUNCTION uint4and(uint4, uint4) PARALLEL SAFE;
+ALTER FUNCTION uint4or(uint4, uint4) PARALLEL SAFE;
+ALTER FUNCTION uint4xor(uint4, uint4) PARALLEL SAFE;
+ALTER FUNCTION uint4shl(uint4, int4) PARALLEL SAFE;
+ALTER FUNCTION uint4shr(uint4, int4) PARALLEL SAFE;
+ALTER FUNCTION uint4not(uint4) PARALLEL SAFE;
+ALTER FUNCTION uint2and(uint2, uint2) PARALLEL SAFE;
+ALTER FUNCTION uint2or(uint2, uint2) PARALLEL SAFE;
+ALTER FUNCTION uint2xor(uint2, uint2) PARALLEL SAFE;
+ALTER FUNCTION uint2not(uint2) PARALLEL SAFE;
+ALTER FUNCTION uint2shl(uint2, int4) PARALLEL SAFE;
+ALTER FUNCTION uint2shr(uint2, int4) PARALLEL SAFE;
+ALTER FUNCTION uint2_cmp(uint2, uint2) PARALLEL SAFE;
+ALTER FUNCTION uint2_hash(uint2) PARALLEL SAFE;
+ALTER FUNCTION uint4_cmp(uint4, uint4) PARALLEL SAFE;
+ALTER FUNCTION uint4_hash(uint4) PARALLEL SAFE;
+
+
+-- Selectivity estimators
+
+CREATE FUNCTION uint_scalarltsel(internal, oid, internal, integer) RETURNS float8
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT STABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint_scalargtsel(internal, oid, internal, integer) RETURNS float8
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT STABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint_scalarlesel(internal, oid, internal, integer) RETURNS float8
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT STABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint_scalargesel(internal, oid, internal, integer) RETURNS float8
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT STABLE PARALLEL SAFE;
+
+ALTER OPERATOR < (uint2, uint2) SET (RESTRICT = uint_scalarltsel, JOIN = scalarltjoinsel);
+ALTER OPERATOR <= (uint2, uint2) SET (RESTRICT = uint_scalarlesel, JOIN = scalarlejoinsel);
+ALTER OPERATOR > (uint2, uint2) SET (RESTRICT = uint_scalargtsel, JOIN = scalargtjoinsel);
+ALTER OPERATOR >= (uint2, uint2) SET (RESTRICT = uint_scalargesel, JOIN = scalargejoinsel);
+ALTER OPERATOR = (uint2, uint2) SET (RESTRICT = eqsel, JOIN = eqjoinsel);
+ALTER OPERATOR <> (uint2, uint2) SET (RESTRICT = neqsel, JOIN = neqjoinsel);
+
+ALTER OPERATOR < (uint4, uint4) SET (RESTRICT = uint_scalarltsel, JOIN = scalarltjoinsel);
+ALTER OPERATOR <= (uint4, uint4) SET (RESTRICT = uint_scalarlesel, JOIN = scalarlejoinsel);
+ALTER OPERATOR > (uint4, uint4) SET (RESTRICT = uint_scalargtsel, JOIN = scalargtjoinsel);
+ALTER OPERATOR >= (uint4, uint4) SET (RESTRICT = uint_scalargesel, JOIN = scalargejoinsel);
+ALTER OPERATOR = (uint4, uint4) SET (RESTRICT = eqsel, JOIN = eqjoinsel);
+ALTER OPERATOR <> (uint4, uint4) SET (RESTRICT = neqsel, JOIN = neqjoinsel);
+
+ALTER OPERATOR < (uint2, uint4) SET (RESTRICT = uint_scalarltsel, JOIN = scalarltjoinsel);
+ALTER OPERATOR <= (uint2, uint4) SET (RESTRICT = uint_scalarlesel, JOIN = scalarlejoinsel);
+ALTER OPERATOR > (uint2, uint4) SET (RESTRICT = uint_scalargtsel, JOIN = scalargtjoinsel);
+ALTER OPERATOR >= (uint2, uint4) SET (RESTRICT = uint_scalargesel, JOIN = scalargejoinsel);
+ALTER OPERATOR = (uint2, uint4) SET (RESTRICT = eqsel, JOIN = eqjoinsel);
+ALTER OPERATOR <> (uint2, uint4) SET (RESTRICT = neqsel, JOIN = neqjoinsel);
+
+ALTER OPERATOR < (uint4, uint2) SET (RESTRICT = uint_scalarltsel, JOIN = scalarltjoinsel);
+ALTER OPERATOR <= (uint4, uint2) SET (RESTRICT = uint_scalarlesel, JOIN = scalarlejoinsel);
+ALTER OPERATOR > (uint4, uint2) SET (RESTRICT = uint_scalargtsel, JOIN = scalargtjoinsel);
+ALTER OPERATOR >= (uint4, uint2) SET (RESTRICT = uint_scalargesel, JOIN = scalargejoinsel);
+ALTER OPERATOR = (uint4, uint2) SET (RESTRICT = eqsel, JOIN = eqjoinsel);
+ALTER OPERATOR <> (uint4, uint2) SET (RESTRICT = neqsel, JOIN = neqjoinsel);
+
+-- The btree and hash opclasses already exist, so the equality operators
+-- can be marked mergeable and hashable.  ALTER OPERATOR can only do that
+-- from PostgreSQL 17 on; older servers need the catalog updated directly.
+DO $$
+BEGIN
+    IF current_setting('server_version_num')::int >= 170000 THEN
+        ALTER OPERATOR = (uint2, uint2) SET (HASHES, MERGES);
+        ALTER OPERATOR = (uint4, uint4) SET (HASHES, MERGES);
+    ELSE
+        UPDATE pg_catalog.pg_operator SET oprcanmerge = true, oprcanhash = true
+        WHERE oid IN ('=(uint2, uint2)'::pg_catalog.regoperator,
+                      '=(uint4, uint4)'::pg_catalog.regoperator);
+    END IF;
+END
+$$;
+
+
+-- UINT 8 definition
+CREATE TYPE uint8;
+
+CREATE FUNCTION uint8in(cstring) RETURNS uint8
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint8out(uint8) RETURNS cstring
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint8recv(internal) RETURNS uint8
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint8send(uint8) RETURNS bytea
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE TYPE uint8 (
+    LIKE = int8,
+    INPUT = uint8in,
+    OUTPUT = uint8out,
+    RECEIVE = uint8recv,
+    SEND = uint8send
+);
+
+-- conversion functions
+
+CREATE FUNCTION u4tou8(uint4) RETURNS uint8
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION u8tou4(uint8) RETURNS uint4
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION u2tou8(uint2) RETURNS uint8
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION u8tou2(uint8) RETURNS uint2
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION u8tod(uint8) RETURNS float8
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION dtou8(float8) RETURNS uint8
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION u8tonumeric(uint8) RETURNS numeric
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION numerictou8(numeric) RETURNS uint8
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+-- arithmetic and logic functions
+
+CREATE FUNCTION uint8eq(uint8, uint8) RETURNS BOOLEAN
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint8ne(uint8, uint8) RETURNS BOOLEAN
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint8lt(uint8, uint8) RETURNS BOOLEAN
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint8le(uint8, uint8) RETURNS BOOLEAN
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint8gt(uint8, uint8) RETURNS BOOLEAN
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint8ge(uint8, uint8) RETURNS BOOLEAN
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint84eq(uint8, uint4) RETURNS BOOLEAN
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint84ne(uint8, uint4) RETURNS BOOLEAN
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint84lt(uint8, uint4) RETURNS BOOLEAN
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint84le(uint8, uint4) RETURNS BOOLEAN
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint84gt(uint8, uint4) RETURNS BOOLEAN
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint84ge(uint8, uint4) RETURNS BOOLEAN
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint48eq(uint4, uint8) RETURNS BOOLEAN
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint48ne(uint4, uint8) RETURNS BOOLEAN
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint48lt(uint4, uint8) RETURNS BOOLEAN
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint48le(uint4, uint8) RETURNS BOOLEAN
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint48gt(uint4, uint8) RETURNS BOOLEAN
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint48ge(uint4, uint8) RETURNS BOOLEAN
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint82eq(uint8, uint2) RETURNS BOOLEAN
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint82ne(uint8, uint2) RETURNS BOOLEAN
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint82lt(uint8, uint2) RETURNS BOOLEAN
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint82le(uint8, uint2) RETURNS BOOLEAN
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint82gt(uint8, uint2) RETURNS BOOLEAN
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint82ge(uint8, uint2) RETURNS BOOLEAN
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint28eq(uint2, uint8) RETURNS BOOLEAN
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint28ne(uint2, uint8) RETURNS BOOLEAN
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint28lt(uint2, uint8) RETURNS BOOLEAN
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint28le(uint2, uint8) RETURNS BOOLEAN
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint28gt(uint2, uint8) RETURNS BOOLEAN
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint28ge(uint2, uint8) RETURNS BOOLEAN
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint8up(uint8) RETURNS uint8
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint8pl(uint8, uint8) RETURNS uint8
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint8mi(uint8, uint8) RETURNS uint8
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint8mul(uint8, uint8) RETURNS uint8
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint8div(uint8, uint8) RETURNS uint8
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint8mod(uint8, uint8) RETURNS uint8
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint8inc(uint8) RETURNS uint8
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint84pl(uint8, uint4) RETURNS uint8
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint84mi(uint8, uint4) RETURNS uint8
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint84mul(uint8, uint4) RETURNS uint8
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint84div(uint8, uint4) RETURNS uint8
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint48pl(uint4, uint8) RETURNS uint8
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint48mi(uint4, uint8) RETURNS uint8
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint48mul(uint4, uint8) RETURNS uint8
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint48div(uint4, uint8) RETURNS uint8
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint82pl(uint8, uint2) RETURNS uint8
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint82mi(uint8, uint2) RETURNS uint8
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint82mul(uint8, uint2) RETURNS uint8
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint82div(uint8, uint2) RETURNS uint8
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint28pl(uint2, uint8) RETURNS uint8
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint28mi(uint2, uint8) RETURNS uint8
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint28mul(uint2, uint8) RETURNS uint8
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint28div(uint2, uint8) RETURNS uint8
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint8larger(uint8, uint8) RETURNS uint8
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint8smaller(uint8, uint8) RETURNS uint8
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint8and(uint8, uint8) RETURNS uint8
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint8or(uint8, uint8) RETURNS uint8
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint8xor(uint8, uint8) RETURNS uint8
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint8shl(uint8, int4) RETURNS uint8
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint8shr(uint8, int4) RETURNS uint8
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint8not(uint8) RETURNS uint8
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+
+-- UINT 8 operators
+
+CREATE CAST (int8 AS uint8) WITHOUT FUNCTION;
+CREATE CAST (uint8 AS int8) WITHOUT FUNCTION;
+CREATE CAST (uint8 AS float8) WITH FUNCTION u8tod(uint8);
+CREATE CAST (float8 AS uint8) WITH FUNCTION dtou8(float8);
+CREATE CAST (uint8 AS numeric) WITH FUNCTION u8tonumeric(uint8) AS ASSIGNMENT;
+CREATE CAST (numeric AS uint8) WITH FUNCTION numerictou8(numeric) AS ASSIGNMENT;
+
+CREATE OPERATOR + (
+    rightarg = uint8,
+    procedure = uint8up
+);
+
+CREATE OPERATOR + (
+    leftarg = uint8,
+    rightarg = uint8,
+    procedure = uint8pl,
+    commutator = +
+);
+
+CREATE OPERATOR - (
+    leftarg = uint8,
+    rightarg = uint8,
+    procedure = uint8mi
+);
+
+CREATE OPERATOR * (
+    leftarg = uint8,
+    rightarg = uint8,
+    procedure = uint8mul,
+    commutator = *
+);
+
+CREATE OPERATOR / (
+    leftarg = uint8,
+    rightarg = uint8,
+    procedure = uint8div
+);
+
+CREATE OPERATOR % (
+    leftarg = uint8,
+    rightarg = uint8,
+    procedure = uint8mod
+);
+
+CREATE OPERATOR & (
+    leftarg = uint8,
+    rightarg = uint8,
+    procedure = uint8and,
+    commutator = &
+);
+
+CREATE OPERATOR | (
+    leftarg = uint8,
+    rightarg = uint8,
+    procedure = uint8or,
+    commutator = |
+);
+
+CREATE OPERATOR # (
+    leftarg = uint8,
+    rightarg = uint8,
+    procedure = uint8xor,
+    commutator = #
+);
+
+CREATE OPERATOR ~ (
+    rightarg = uint8,
+    procedure = uint8not
+);
+
+CREATE OPERATOR << (
+    rightarg = int4,
+    leftarg = uint8,
+    procedure = uint8shl
+);
+
+CREATE OPERATOR >> (
+    rightarg = int4,
+    leftarg = uint8,
+    procedure = uint8shr
+);
+
+CREATE OPERATOR > (
+    rightarg = uint8,
+    leftarg = uint8,
+    procedure = uint8gt,
+    commutator = <,
+    negator = <=,
+    restrict = uint_scalargtsel,
+    join = scalargtjoinsel
+);
+
+CREATE OPERATOR < (
+    rightarg = uint8,
+    leftarg = uint8,
+    procedure = uint8lt,
+    commutator = >,
+    negator = >=,
+    restrict = uint_scalarltsel,
+    join = scalarltjoinsel
+);
+
+CREATE OPERATOR <= (
+    rightarg = uint8,
+    leftarg = uint8,
+    procedure = uint8le,
+    commutator = >=,
+    negator = >,
+    restrict = uint_scalarlesel,
+    join = scalarlejoinsel
+);
+
+CREATE OPERATOR >= (
+    rightarg = uint8,
+    leftarg = uint8,
+    procedure = uint8ge,
+    commutator = <=,
+    negator = <,
+    restrict = uint_scalargesel,
+    join = scalargejoinsel
+);
+
+CREATE OPERATOR = (
+    rightarg = uint8,
+    leftarg = uint8,
+    procedure = uint8eq,
+    commutator = =,
+    negator = <>,
+    restrict = eqsel,
+    join = eqjoinsel,
+    hashes,
+    merges
+);
+
+CREATE OPERATOR <> (
+    rightarg = uint8,
+    leftarg = uint8,
+    procedure = uint8ne,
+    commutator = <>,
+    negator = =,
+    restrict = neqsel,
+    join = neqjoinsel
+);
+
+-- UINT 4/8 operators
+
+CREATE CAST (uint4 AS uint8) WITH FUNCTION u4tou8(uint4) AS IMPLICIT;
+
+CREATE OPERATOR > (
+    rightarg = uint8,
+    leftarg = uint4,
+    procedure = uint48gt,
+    commutator = <,
+    negator = <=,
+    restrict = uint_scalargtsel,
+    join = scalargtjoinsel
+);
+
+CREATE OPERATOR < (
+    rightarg = uint8,
+    leftarg = uint4,
+    procedure = uint48lt,
+    commutator = >,
+    negator = >=,
+    restrict = uint_scalarltsel,
+    join = scalarltjoinsel
+);
+
+CREATE OPERATOR <= (
+    rightarg = uint8,
+    leftarg = uint4,
+    procedure = uint48le,
+    commutator = >=,
+    negator = >,
+    restrict = uint_scalarlesel,
+    join = scalarlejoinsel
+);
+
+CREATE OPERATOR >= (
+    rightarg = uint8,
+    leftarg = uint4,
+    procedure = uint48ge,
+    commutator = <=,
+    negator = <,
+    restrict = uint_scalargesel,
+    join = scalargejoinsel
+);
+
+CREATE OPERATOR = (
+    rightarg = uint8,
+    leftarg = uint4,
+    procedure = uint48eq,
+    commutator = =,
+    negator = <>,
+    restrict = eqsel,
+    join = eqjoinsel,
+    hashes
+);
+
+CREATE OPERATOR <> (
+    rightarg = uint8,
+    leftarg = uint4,
+    procedure = uint48ne,
+    commutator = <>,
+    negator = =,
+    restrict = neqsel,
+    join = neqjoinsel
+);
+
+CREATE OPERATOR + (
+    leftarg = uint4,
+    rightarg = uint8,
+    procedure = uint48pl,
+    commutator = +
+);
+
+CREATE OPERATOR - (
+    leftarg = uint4,
+    rightarg = uint8,
+    procedure = uint48mi
+);
+
+CREATE OPERATOR * (
+    leftarg = uint4,
+    rightarg = uint8,
+    procedure = uint48mul,
+    commutator = *
+);
+
+CREATE OPERATOR / (
+    leftarg = uint4,
+    rightarg = uint8,
+    procedure = uint48div
+);
+
+-- UINT 8/4 operators
+
+CREATE CAST (uint8 AS uint4) WITH FUNCTION u8tou4(uint8);
+
+CREATE OPERATOR > (
+    rightarg = uint4,
+    leftarg = uint8,
+    procedure = uint84gt,
+    commutator = <,
+    negator = <=,
+    restrict = uint_scalargtsel,
+    join = scalargtjoinsel
+);
+
+CREATE OPERATOR < (
+    rightarg = uint4,
+    leftarg = uint8,
+    procedure = uint84lt,
+    commutator = >,
+    negator = >=,
+    restrict = uint_scalarltsel,
+    join = scalarltjoinsel
+);
+
+CREATE OPERATOR <= (
+    rightarg = uint4,
+    leftarg = uint8,
+    procedure = uint84le,
+    commutator = >=,
+    negator = >,
+    restrict = uint_scalarlesel,
+    join = scalarlejoinsel
+);
+
+CREATE OPERATOR >= (
+    rightarg = uint4,
+    leftarg = uint8,
+    procedure = uint84ge,
+    commutator = <=,
+    negator = <,
+    restrict = uint_scalargesel,
+    join = scalargejoinsel
+);
+
+CREATE OPERATOR = (
+    rightarg = uint4,
+    leftarg = uint8,
+    procedure = uint84eq,
+    commutator = =,
+    negator = <>,
+    restrict = eqsel,
+    join = eqjoinsel,
+    hashes
+);
+
+CREATE OPERATOR <> (
+    rightarg = uint4,
+    leftarg = uint8,
+    procedure = uint84ne,
+    commutator = <>,
+    negator = =,
+    restrict = neqsel,
+    join = neqjoinsel
+);
+
+CREATE OPERATOR + (
+    leftarg = uint8,
+    rightarg = uint4,
+    procedure = uint84pl,
+    commutator = +
+);
+
+CREATE OPERATOR - (
+    leftarg = uint8,
+    rightarg = uint4,
+    procedure = uint84mi
+);
+
+CREATE OPERATOR * (
+    leftarg = uint8,
+    rightarg = uint4,
+    procedure = uint84mul,
+    commutator = *
+);
+
+CREATE OPERATOR / (
+    leftarg = uint8,
+    rightarg = uint4,
+    procedure = uint84div
+);
+
+-- UINT 2/8 operators
+
+CREATE CAST (uint2 AS uint8) WITH FUNCTION u2tou8(uint2) AS IMPLICIT;
+
+CREATE OPERATOR > (
+    rightarg = uint8,
+    leftarg = uint2,
+    procedure = uint28gt,
+    commutator = <,
+    negator = <=,
+    restrict = uint_scalargtsel,
+    join = scalargtjoinsel
+);
+
+CREATE OPERATOR < (
+    rightarg = uint8,
+    leftarg = uint2,
+    procedure = uint28lt,
+    commutator = >,
+    negator = >=,
+    restrict = uint_scalarltsel,
+    join = scalarltjoinsel
+);
+
+CREATE OPERATOR <= (
+    rightarg = uint8,
+    leftarg = uint2,
+    procedure = uint28le,
+    commutator = >=,
+    negator = >,
+    restrict = uint_scalarlesel,
+    join = scalarlejoinsel
+);
+
+CREATE OPERATOR >= (
+    rightarg = uint8,
+    leftarg = uint2,
+    procedure = uint28ge,
+    commutator = <=,
+    negator = <,
+    restrict = uint_scalargesel,
+    join = scalargejoinsel
+);
+
+CREATE OPERATOR = (
+    rightarg = uint8,
+    leftarg = uint2,
+    procedure = uint28eq,
+    commutator = =,
+    negator = <>,
+    restrict = eqsel,
+    join = eqjoinsel,
+    hashes
+);
+
+CREATE OPERATOR <> (
+    rightarg = uint8,
+    leftarg = uint2,
+    procedure = uint28ne,
+    commutator = <>,
+    negator = =,
+    restrict = neqsel,
+    join = neqjoinsel
+);
+
+CREATE OPERATOR + (
+    leftarg = uint2,
+    rightarg = uint8,
+    procedure = uint28pl,
+    commutator = +
+);
+
+CREATE OPERATOR - (
+    leftarg = uint2,
+    rightarg = uint8,
+    procedure = uint28mi
+);
+
+CREATE OPERATOR * (
+    leftarg = uint2,
+    rightarg = uint8,
+    procedure = uint28mul,
+    commutator = *
+);
+
+CREATE OPERATOR / (
+    leftarg = uint2,
+    rightarg = uint8,
+    procedure = uint28div
+);
+
+-- UINT 8/2 operators
+
+CREATE CAST (uint8 AS uint2) WITH FUNCTION u8tou2(uint8);
+
+CREATE OPERATOR > (
+    rightarg = uint2,
+    leftarg = uint8,
+    procedure = uint82gt,
+    commutator = <,
+    negator = <=,
+    restrict = uint_scalargtsel,
+    join = scalargtjoinsel
+);
+
+CREATE OPERATOR < (
+    rightarg = uint2,
+    leftarg = uint8,
+    procedure = uint82lt,
+    commutator = >,
+    negator = >=,
+    restrict = uint_scalarltsel,
+    join = scalarltjoinsel
+);
+
+CREATE OPERATOR <= (
+    rightarg = uint2,
+    leftarg = uint8,
+    procedure = uint82le,
+    commutator = >=,
+    negator = >,
+    restrict = uint_scalarlesel,
+    join = scalarlejoinsel
+);
+
+CREATE OPERATOR >= (
+    rightarg = uint2,
+    leftarg = uint8,
+    procedure = uint82ge,
+    commutator = <=,
+    negator = <,
+    restrict = uint_scalargesel,
+    join = scalargejoinsel
+);
+
+CREATE OPERATOR = (
+    rightarg = uint2,
+    leftarg = uint8,
+    procedure = uint82eq,
+    commutator = =,
+    negator = <>,
+    restrict = eqsel,
+    join = eqjoinsel,
+    hashes
+);
+
+CREATE OPERATOR <> (
+    rightarg = uint2,
+    leftarg = uint8,
+    procedure = uint82ne,
+    commutator = <>,
+    negator = =,
+    restrict = neqsel,
+    join = neqjoinsel
+);
+
+CREATE OPERATOR + (
+    leftarg = uint8,
+    rightarg = uint2,
+    procedure = uint82pl,
+    commutator = +
+);
+
+CREATE OPERATOR - (
+    leftarg = uint8,
+    rightarg = uint2,
+    procedure = uint82mi
+);
+
+CREATE OPERATOR * (
+    leftarg = uint8,
+    rightarg = uint2,
+    procedure = uint82mul,
+    commutator = *
+);
+
+CREATE OPERATOR / (
+    leftarg = uint8,
+    rightarg = uint2,
+    procedure = uint82div
+);
+
+-- UINT 8 operator classes
+
+CREATE FUNCTION uint8_cmp(uint8, uint8) RETURNS INTEGER
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint8_hash(uint8) RETURNS INTEGER
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint8_sortsupport(internal) RETURNS void
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE OPERATOR CLASS uint8_ops_btree
+    DEFAULT FOR TYPE uint8 USING btree AS
+        OPERATOR        1       < ,
+        OPERATOR        2       <= ,
+        OPERATOR        3       = ,
+        OPERATOR        4       >= ,
+        OPERATOR        5       > ,
+        FUNCTION        1       uint8_cmp(uint8, uint8),
+        FUNCTION        2       uint8_sortsupport(internal);
+
+CREATE OPERATOR CLASS uint8_ops_hash
+    DEFAULT FOR TYPE uint8 USING hash AS
+        OPERATOR        1       = ,
+        FUNCTION        1       uint8_hash(uint8);
+
+
+-- UINT 1 definition
+CREATE TYPE uint1;
+
+CREATE FUNCTION uint1in(cstring) RETURNS uint1
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint1out(uint1) RETURNS cstring
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint1recv(internal) RETURNS uint1
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint1send(uint1) RETURNS bytea
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE TYPE uint1 (
+    INTERNALLENGTH = 1,
+    INPUT = uint1in,
+    OUTPUT = uint1out,
+    RECEIVE = uint1recv,
+    SEND = uint1send,
+    STORAGE = plain,
+    ALIGNMENT = char,
+    PASSEDBYVALUE
+);
+
+-- conversion functions
+
+CREATE FUNCTION u1tou2(uint1) RETURNS uint2
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION u2tou1(uint2) RETURNS uint1
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION u1tou4(uint1) RETURNS uint4
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION u4tou1(uint4) RETURNS uint1
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION u1tou8(uint1) RETURNS uint8
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION u8tou1(uint8) RETURNS uint1
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION u1toi4(uint1) RETURNS int4
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION i4tou1(int4) RETURNS uint1
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+-- arithmetic and logic functions
+
+CREATE FUNCTION uint1eq(uint1, uint1) RETURNS BOOLEAN
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint1ne(uint1, uint1) RETURNS BOOLEAN
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint1lt(uint1, uint1) RETURNS BOOLEAN
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint1le(uint1, uint1) RETURNS BOOLEAN
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint1gt(uint1, uint1) RETURNS BOOLEAN
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint1ge(uint1, uint1) RETURNS BOOLEAN
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint1pl(uint1, uint1) RETURNS uint1
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint1mi(uint1, uint1) RETURNS uint1
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint1mul(uint1, uint1) RETURNS uint1
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint1div(uint1, uint1) RETURNS uint1
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint1mod(uint1, uint1) RETURNS uint1
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint1larger(uint1, uint1) RETURNS uint1
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint1smaller(uint1, uint1) RETURNS uint1
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint1and(uint1, uint1) RETURNS uint1
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint1or(uint1, uint1) RETURNS uint1
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint1xor(uint1, uint1) RETURNS uint1
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint1shl(uint1, int4) RETURNS uint1
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint1shr(uint1, int4) RETURNS uint1
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint1not(uint1) RETURNS uint1
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+
+-- UINT 1 operators
+
+-- Only the cast to uint2 is implicit: mixed-width expressions then resolve
+-- through the uint2 cross-type operators instead of being ambiguous.
+CREATE CAST (uint1 AS uint2) WITH FUNCTION u1tou2(uint1) AS IMPLICIT;
+CREATE CAST (uint1 AS uint4) WITH FUNCTION u1tou4(uint1) AS ASSIGNMENT;
+CREATE CAST (uint1 AS uint8) WITH FUNCTION u1tou8(uint1) AS ASSIGNMENT;
+CREATE CAST (uint2 AS uint1) WITH FUNCTION u2tou1(uint2);
+CREATE CAST (uint4 AS uint1) WITH FUNCTION u4tou1(uint4);
+CREATE CAST (uint8 AS uint1) WITH FUNCTION u8tou1(uint8);
+CREATE CAST (int4 AS uint1) WITH FUNCTION i4tou1(int4);
+-- Not implicit: "uint1_col = 5" would then match int4 = int4 as well as
+-- uint2 = int4.
+CREATE CAST (uint1 AS int4) WITH FUNCTION u1toi4(uint1) AS ASSIGNMENT;
+
+CREATE OPERATOR + (
+    leftarg = uint1,
+    rightarg = uint1,
+    procedure = uint1pl,
+    commutator = +
+);
+
+CREATE OPERATOR - (
+    leftarg = uint1,
+    rightarg = uint1,
+    procedure = uint1mi
+);
+
+CREATE OPERATOR * (
+    leftarg = uint1,
+    rightarg = uint1,
+    procedure = uint1mul,
+    commutator = *
+);
+
+CREATE OPERATOR / (
+    leftarg = uint1,
+    rightarg = uint1,
+    procedure = uint1div
+);
+
+CREATE OPERATOR % (
+    leftarg = uint1,
+    rightarg = uint1,
+    procedure = uint1mod
+);
+
+CREATE OPERATOR & (
+    leftarg = uint1,
+    rightarg = uint1,
+    procedure = uint1and,
+    commutator = &
+);
+
+CREATE OPERATOR | (
+    leftarg = uint1,
+    rightarg = uint1,
+    procedure = uint1or,
+    commutator = |
+);
+
+CREATE OPERATOR # (
+    leftarg = uint1,
+    rightarg = uint1,
+    procedure = uint1xor,
+    commutator = #
+);
+
+CREATE OPERATOR ~ (
+    rightarg = uint1,
+    procedure = uint1not
+);
+
+CREATE OPERATOR << (
+    rightarg = int4,
+    leftarg = uint1,
+    procedure = uint1shl
+);
+
+CREATE OPERATOR >> (
+    rightarg = int4,
+    leftarg = uint1,
+    procedure = uint1shr
+);
+
+CREATE OPERATOR > (
+    rightarg = uint1,
+    leftarg = uint1,
+    procedure = uint1gt,
+    commutator = <,
+    negator = <=,
+    restrict = uint_scalargtsel,
+    join = scalargtjoinsel
+);
+
+CREATE OPERATOR < (
+    rightarg = uint1,
+    leftarg = uint1,
+    procedure = uint1lt,
+    commutator = >,
+    negator = >=,
+    restrict = uint_scalarltsel,
+    join = scalarltjoinsel
+);
+
+CREATE OPERATOR <= (
+    rightarg = uint1,
+    leftarg = uint1,
+    procedure = uint1le,
+    commutator = >=,
+    negator = >,
+    restrict = uint_scalarlesel,
+    join = scalarlejoinsel
+);
+
+CREATE OPERATOR >= (
+    rightarg = uint1,
+    leftarg = uint1,
+    procedure = uint1ge,
+    commutator = <=,
+    negator = <,
+    restrict = uint_scalargesel,
+    join = scalargejoinsel
+);
+
+CREATE OPERATOR = (
+    rightarg = uint1,
+    leftarg = uint1,
+    procedure = uint1eq,
+    commutator = =,
+    negator = <>,
+    restrict = eqsel,
+    join = eqjoinsel,
+    hashes,
+    merges
+);
+
+CREATE OPERATOR <> (
+    rightarg = uint1,
+    leftarg = uint1,
+    procedure = uint1ne,
+    commutator = <>,
+    negator = =,
+    restrict = neqsel,
+    join = neqjoinsel
+);
+
+-- UINT 1 operator classes
+
+CREATE FUNCTION uint1_cmp(uint1, uint1) RETURNS INTEGER
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint1_hash(uint1) RETURNS INTEGER
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint1_sortsupport(internal) RETURNS void
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE OPERATOR CLASS uint1_ops_btree
+    DEFAULT FOR TYPE uint1 USING btree AS
+        OPERATOR        1       < ,
+        OPERATOR        2       <= ,
+        OPERATOR        3       = ,
+        OPERATOR        4       >= ,
+        OPERATOR        5       > ,
+        FUNCTION        1       uint1_cmp(uint1, uint1),
+        FUNCTION        2       uint1_sortsupport(internal);
+
+CREATE OPERATOR CLASS uint1_ops_hash
+    DEFAULT FOR TYPE uint1 USING hash AS
+        OPERATOR        1       = ,
+        FUNCTION        1       uint1_hash(uint1);
+
+
+-- UINT 2/4 sort support
+
+CREATE FUNCTION uint2_sortsupport(internal) RETURNS void
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint4_sortsupport(internal) RETURNS void
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+ALTER OPERATOR FAMILY uint2_ops_btree USING btree ADD
+        FUNCTION        2       (uint2, uint2) uint2_sortsupport(internal);
+
+ALTER OPERATOR FAMILY uint4_ops_btree USING btree ADD
+        FUNCTION        2       (uint4, uint4) uint4_sortsupport(internal);
+
+
+-- Aggregates
+
+CREATE FUNCTION uint1_sum(uint8, uint1) RETURNS uint8
+AS 'MODULE_PATHNAME'
+LANGUAGE C IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint2_sum(uint8, uint2) RETURNS uint8
+AS 'MODULE_PATHNAME'
+LANGUAGE C IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint4_sum(uint8, uint4) RETURNS uint8
+AS 'MODULE_PATHNAME'
+LANGUAGE C IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint1_avg_accum(internal, uint1) RETURNS internal
+AS 'MODULE_PATHNAME'
+LANGUAGE C IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint2_avg_accum(internal, uint2) RETURNS internal
+AS 'MODULE_PATHNAME'
+LANGUAGE C IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint4_avg_accum(internal, uint4) RETURNS internal
+AS 'MODULE_PATHNAME'
+LANGUAGE C IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint8_avg_accum(internal, uint8) RETURNS internal
+AS 'MODULE_PATHNAME'
+LANGUAGE C IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint8_avg_combine(internal, internal) RETURNS internal
+AS 'MODULE_PATHNAME'
+LANGUAGE C IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint8_avg_serialize(internal) RETURNS bytea
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint8_avg_deserialize(bytea, internal) RETURNS internal
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint8_sum_final(internal) RETURNS numeric
+AS 'MODULE_PATHNAME'
+LANGUAGE C IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint8_avg_final(internal) RETURNS numeric
+AS 'MODULE_PATHNAME'
+LANGUAGE C IMMUTABLE PARALLEL SAFE;
+
+CREATE AGGREGATE sum(uint1) (
+    SFUNC = uint1_sum,
+    STYPE = uint8,
+    COMBINEFUNC = uint8pl,
+    PARALLEL = SAFE
+);
+
+CREATE AGGREGATE sum(uint2) (
+    SFUNC = uint2_sum,
+    STYPE = uint8,
+    COMBINEFUNC = uint8pl,
+    PARALLEL = SAFE
+);
+
+CREATE AGGREGATE sum(uint4) (
+    SFUNC = uint4_sum,
+    STYPE = uint8,
+    COMBINEFUNC = uint8pl,
+    PARALLEL = SAFE
+);
+
+CREATE AGGREGATE sum(uint8) (
+    SFUNC = uint8_avg_accum,
+    STYPE = internal,
+    SSPACE = 24,
+    FINALFUNC = uint8_sum_final,
+    COMBINEFUNC = uint8_avg_combine,
+    SERIALFUNC = uint8_avg_serialize,
+    DESERIALFUNC = uint8_avg_deserialize,
+    PARALLEL = SAFE
+);
+
+CREATE AGGREGATE avg(uint1) (
+    SFUNC = uint1_avg_accum,
+    STYPE = internal,
+    SSPACE = 24,
+    FINALFUNC = uint8_avg_final,
+    COMBINEFUNC = uint8_avg_combine,
+    SERIALFUNC = uint8_avg_serialize,
+    DESERIALFUNC = uint8_avg_deserialize,
+    PARALLEL = SAFE
+);
+
+CREATE AGGREGATE avg(uint2) (
+    SFUNC = uint2_avg_accum,
+    STYPE = internal,
+    SSPACE = 24,
+    FINALFUNC = uint8_avg_final,
+    COMBINEFUNC = uint8_avg_combine,
+    SERIALFUNC = uint8_avg_serialize,
+    DESERIALFUNC = uint8_avg_deserialize,
+    PARALLEL = SAFE
+);
+
+CREATE AGGREGATE avg(uint4) (
+    SFUNC = uint4_avg_accum,
+    STYPE = internal,
+    SSPACE = 24,
+    FINALFUNC = uint8_avg_final,
+    COMBINEFUNC = uint8_avg_combine,
+    SERIALFUNC = uint8_avg_serialize,
+    DESERIALFUNC = uint8_avg_deserialize,
+    PARALLEL = SAFE
+);
+
+CREATE AGGREGATE avg(uint8) (
+    SFUNC = uint8_avg_accum,
+    STYPE = internal,
+    SSPACE = 24,
+    FINALFUNC = uint8_avg_final,
+    COMBINEFUNC = uint8_avg_combine,
+    SERIALFUNC = uint8_avg_serialize,
+    DESERIALFUNC = uint8_avg_deserialize,
+    PARALLEL = SAFE
+);
+
+CREATE AGGREGATE min(uint1) (
+    SFUNC = uint1smaller,
+    STYPE = uint1,
+    COMBINEFUNC = uint1smaller,
+    SORTOP = <,
+    PARALLEL = SAFE
+);
+
+CREATE AGGREGATE max(uint1) (
+    SFUNC = uint1larger,
+    STYPE = uint1,
+    COMBINEFUNC = uint1larger,
+    SORTOP = >,
+    PARALLEL = SAFE
+);
+
+CREATE AGGREGATE bit_and(uint1) (
+    SFUNC = uint1and,
+    STYPE = uint1,
+    COMBINEFUNC = uint1and,
+    PARALLEL = SAFE
+);
+
+CREATE AGGREGATE bit_or(uint1) (
+    SFUNC = uint1or,
+    STYPE = uint1,
+    COMBINEFUNC = uint1or,
+    PARALLEL = SAFE
+);
+
+CREATE AGGREGATE bit_xor(uint1) (
+    SFUNC = uint1xor,
+    STYPE = uint1,
+    COMBINEFUNC = uint1xor,
+    PARALLEL = SAFE
+);
+
+CREATE AGGREGATE min(uint2) (
+    SFUNC = uint2smaller,
+    STYPE = uint2,
+    COMBINEFUNC = uint2smaller,
+    SORTOP = <,
+    PARALLEL = SAFE
+);
+
+CREATE AGGREGATE max(uint2) (
+    SFUNC = uint2larger,
+    STYPE = uint2,
+    COMBINEFUNC = uint2larger,
+    SORTOP = >,
+    PARALLEL = SAFE
+);
+
+CREATE AGGREGATE bit_and(uint2) (
+    SFUNC = uint2and,
+    STYPE = uint2,
+    COMBINEFUNC = uint2and,
+    PARALLEL = SAFE
+);
+
+CREATE AGGREGATE bit_or(uint2) (
+    SFUNC = uint2or,
+    STYPE = uint2,
+    COMBINEFUNC = uint2or,
+    PARALLEL = SAFE
+);
+
+CREATE AGGREGATE bit_xor(uint2) (
+    SFUNC = uint2xor,
+    STYPE = uint2,
+    COMBINEFUNC = uint2xor,
+    PARALLEL = SAFE
+);
+
+CREATE AGGREGATE min(uint4) (
+    SFUNC = uint4smaller,
+    STYPE = uint4,
+    COMBINEFUNC = uint4smaller,
+    SORTOP = <,
+    PARALLEL = SAFE
+);
+
+CREATE AGGREGATE max(uint4) (
+    SFUNC = uint4larger,
+    STYPE = uint4,
+    COMBINEFUNC = uint4larger,
+    SORTOP = >,
+    PARALLEL = SAFE
+);
+
+CREATE AGGREGATE bit_and(uint4) (
+    SFUNC = uint4and,
+    STYPE = uint4,
+    COMBINEFUNC = uint4and,
+    PARALLEL = SAFE
+);
+
+CREATE AGGREGATE bit_or(uint4) (
+    SFUNC = uint4or,
+    STYPE = uint4,
+    COMBINEFUNC = uint4or,
+    PARALLEL = SAFE
+);
+
+CREATE AGGREGATE bit_xor(uint4) (
+    SFUNC = uint4xor,
+    STYPE = uint4,
+    COMBINEFUNC = uint4xor,
+    PARALLEL = SAFE
+);
+
+CREATE AGGREGATE min(uint8) (
+    SFUNC = uint8smaller,
+    STYPE = uint8,
+    COMBINEFUNC = uint8smaller,
+    SORTOP = <,
+    PARALLEL = SAFE
+);
+
+CREATE AGGREGATE max(uint8) (
+    SFUNC = uint8larger,
+    STYPE = uint8,
+    COMBINEFUNC = uint8larger,
+    SORTOP = >,
+    PARALLEL = SAFE
+);
+
+CREATE AGGREGATE bit_and(uint8) (
+    SFUNC = uint8and,
+    STYPE = uint8,
+    COMBINEFUNC = uint8and,
+    PARALLEL = SAFE
+);
+
+CREATE AGGREGATE bit_or(uint8) (
+    SFUNC = uint8or,
+    STYPE = uint8,
+    COMBINEFUNC = uint8or,
+    PARALLEL = SAFE
+);
+
+CREATE AGGREGATE bit_xor(uint8) (
+    SFUNC = uint8xor,
+    STYPE = uint8,
+    COMBINEFUNC = uint8xor,
+    PARALLEL = SAFE
+);
+
+
+-- Cross-type operator families
+--
+-- Comparisons between an unsigned and a signed type go by numeric value: a
+-- negative value is smaller than, and never equal to, any unsigned one.
+-- Adding them and the unsigned cross-type operators to the per-type btree
+-- and hash families lets "uint4_col = 5" or "uint8_col < some_uint4" use an
+-- index, be hashed, or prune partitions without a cast on the column.
+-- Only operators with the family's own type on the left are needed: the
+-- planner commutes clauses as required.  A signed value can only equal an
+-- unsigned one when it is non-negative, and then the core hashint2/4/8
+-- hash it the same as uint2/4/8_hash, so they serve as its hash support.
+
+-- UINT 2/INT 2 operators
+
+CREATE FUNCTION uint2int2eq(uint2, int2) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint2int2ne(uint2, int2) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint2int2lt(uint2, int2) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint2int2le(uint2, int2) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint2int2gt(uint2, int2) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint2int2ge(uint2, int2) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint2int2_cmp(uint2, int2) RETURNS INTEGER
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE OPERATOR > (
+    rightarg = int2,
+    leftarg = uint2,
+    procedure = uint2int2gt,
+    commutator = <,
+    negator = <=,
+    restrict = uint_scalargtsel,
+    join = scalargtjoinsel
+);
+
+CREATE OPERATOR < (
+    rightarg = int2,
+    leftarg = uint2,
+    procedure = uint2int2lt,
+    commutator = >,
+    negator = >=,
+    restrict = uint_scalarltsel,
+    join = scalarltjoinsel
+);
+
+CREATE OPERATOR <= (
+    rightarg = int2,
+    leftarg = uint2,
+    procedure = uint2int2le,
+    commutator = >=,
+    negator = >,
+    restrict = uint_scalarlesel,
+    join = scalarlejoinsel
+);
+
+CREATE OPERATOR >= (
+    rightarg = int2,
+    leftarg = uint2,
+    procedure = uint2int2ge,
+    commutator = <=,
+    negator = <,
+    restrict = uint_scalargesel,
+    join = scalargejoinsel
+);
+
+CREATE OPERATOR = (
+    rightarg = int2,
+    leftarg = uint2,
+    procedure = uint2int2eq,
+    commutator = =,
+    negator = <>,
+    restrict = eqsel,
+    join = eqjoinsel,
+    hashes
+);
+
+CREATE OPERATOR <> (
+    rightarg = int2,
+    leftarg = uint2,
+    procedure = uint2int2ne,
+    commutator = <>,
+    negator = =,
+    restrict = neqsel,
+    join = neqjoinsel
+);
+
+-- INT 2/UINT 2 operators
+
+CREATE FUNCTION int2uint2eq(int2, uint2) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION int2uint2ne(int2, uint2) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION int2uint2lt(int2, uint2) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION int2uint2le(int2, uint2) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION int2uint2gt(int2, uint2) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION int2uint2ge(int2, uint2) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION int2uint2_cmp(int2, uint2) RETURNS INTEGER
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE OPERATOR > (
+    rightarg = uint2,
+    leftarg = int2,
+    procedure = int2uint2gt,
+    commutator = <,
+    negator = <=,
+    restrict = uint_scalargtsel,
+    join = scalargtjoinsel
+);
+
+CREATE OPERATOR < (
+    rightarg = uint2,
+    leftarg = int2,
+    procedure = int2uint2lt,
+    commutator = >,
+    negator = >=,
+    restrict = uint_scalarltsel,
+    join = scalarltjoinsel
+);
+
+CREATE OPERATOR <= (
+    rightarg = uint2,
+    leftarg = int2,
+    procedure = int2uint2le,
+    commutator = >=,
+    negator = >,
+    restrict = uint_scalarlesel,
+    join = scalarlejoinsel
+);
+
+CREATE OPERATOR >= (
+    rightarg = uint2,
+    leftarg = int2,
+    procedure = int2uint2ge,
+    commutator = <=,
+    negator = <,
+    restrict = uint_scalargesel,
+    join = scalargejoinsel
+);
+
+CREATE OPERATOR = (
+    rightarg = uint2,
+    leftarg = int2,
+    procedure = int2uint2eq,
+    commutator = =,
+    negator = <>,
+    restrict = eqsel,
+    join = eqjoinsel,
+    hashes
+);
+
+CREATE OPERATOR <> (
+    rightarg = uint2,
+    leftarg = int2,
+    procedure = int2uint2ne,
+    commutator = <>,
+    negator = =,
+    restrict = neqsel,
+    join = neqjoinsel
+);
+
+-- UINT 2/INT 4 operators
+
+CREATE FUNCTION uint2int4eq(uint2, int4) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint2int4ne(uint2, int4) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint2int4lt(uint2, int4) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint2int4le(uint2, int4) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint2int4gt(uint2, int4) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint2int4ge(uint2, int4) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint2int4_cmp(uint2, int4) RETURNS INTEGER
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE OPERATOR > (
+    rightarg = int4,
+    leftarg = uint2,
+    procedure = uint2int4gt,
+    commutator = <,
+    negator = <=,
+    restrict = uint_scalargtsel,
+    join = scalargtjoinsel
+);
+
+CREATE OPERATOR < (
+    rightarg = int4,
+    leftarg = uint2,
+    procedure = uint2int4lt,
+    commutator = >,
+    negator = >=,
+    restrict = uint_scalarltsel,
+    join = scalarltjoinsel
+);
+
+CREATE OPERATOR <= (
+    rightarg = int4,
+    leftarg = uint2,
+    procedure = uint2int4le,
+    commutator = >=,
+    negator = >,
+    restrict = uint_scalarlesel,
+    join = scalarlejoinsel
+);
+
+CREATE OPERATOR >= (
+    rightarg = int4,
+    leftarg = uint2,
+    procedure = uint2int4ge,
+    commutator = <=,
+    negator = <,
+    restrict = uint_scalargesel,
+    join = scalargejoinsel
+);
+
+CREATE OPERATOR = (
+    rightarg = int4,
+    leftarg = uint2,
+    procedure = uint2int4eq,
+    commutator = =,
+    negator = <>,
+    restrict = eqsel,
+    join = eqjoinsel,
+    hashes
+);
+
+CREATE OPERATOR <> (
+    rightarg = int4,
+    leftarg = uint2,
+    procedure = uint2int4ne,
+    commutator = <>,
+    negator = =,
+    restrict = neqsel,
+    join = neqjoinsel
+);
+
+-- INT 4/UINT 2 operators
+
+CREATE FUNCTION int4uint2eq(int4, uint2) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION int4uint2ne(int4, uint2) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION int4uint2lt(int4, uint2) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION int4uint2le(int4, uint2) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION int4uint2gt(int4, uint2) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION int4uint2ge(int4, uint2) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION int4uint2_cmp(int4, uint2) RETURNS INTEGER
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE OPERATOR > (
+    rightarg = uint2,
+    leftarg = int4,
+    procedure = int4uint2gt,
+    commutator = <,
+    negator = <=,
+    restrict = uint_scalargtsel,
+    join = scalargtjoinsel
+);
+
+CREATE OPERATOR < (
+    rightarg = uint2,
+    leftarg = int4,
+    procedure = int4uint2lt,
+    commutator = >,
+    negator = >=,
+    restrict = uint_scalarltsel,
+    join = scalarltjoinsel
+);
+
+CREATE OPERATOR <= (
+    rightarg = uint2,
+    leftarg = int4,
+    procedure = int4uint2le,
+    commutator = >=,
+    negator = >,
+    restrict = uint_scalarlesel,
+    join = scalarlejoinsel
+);
+
+CREATE OPERATOR >= (
+    rightarg = uint2,
+    leftarg = int4,
+    procedure = int4uint2ge,
+    commutator = <=,
+    negator = <,
+    restrict = uint_scalargesel,
+    join = scalargejoinsel
+);
+
+CREATE OPERATOR = (
+    rightarg = uint2,
+    leftarg = int4,
+    procedure = int4uint2eq,
+    commutator = =,
+    negator = <>,
+    restrict = eqsel,
+    join = eqjoinsel,
+    hashes
+);
+
+CREATE OPERATOR <> (
+    rightarg = uint2,
+    leftarg = int4,
+    procedure = int4uint2ne,
+    commutator = <>,
+    negator = =,
+    restrict = neqsel,
+    join = neqjoinsel
+);
+
+-- UINT 2/INT 8 operators
+
+CREATE FUNCTION uint2int8eq(uint2, int8) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint2int8ne(uint2, int8) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint2int8lt(uint2, int8) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint2int8le(uint2, int8) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint2int8gt(uint2, int8) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint2int8ge(uint2, int8) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint2int8_cmp(uint2, int8) RETURNS INTEGER
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE OPERATOR > (
+    rightarg = int8,
+    leftarg = uint2,
+    procedure = uint2int8gt,
+    commutator = <,
+    negator = <=,
+    restrict = uint_scalargtsel,
+    join = scalargtjoinsel
+);
+
+CREATE OPERATOR < (
+    rightarg = int8,
+    leftarg = uint2,
+    procedure = uint2int8lt,
+    commutator = >,
+    negator = >=,
+    restrict = uint_scalarltsel,
+    join = scalarltjoinsel
+);
+
+CREATE OPERATOR <= (
+    rightarg = int8,
+    leftarg = uint2,
+    procedure = uint2int8le,
+    commutator = >=,
+    negator = >,
+    restrict = uint_scalarlesel,
+    join = scalarlejoinsel
+);
+
+CREATE OPERATOR >= (
+    rightarg = int8,
+    leftarg = uint2,
+    procedure = uint2int8ge,
+    commutator = <=,
+    negator = <,
+    restrict = uint_scalargesel,
+    join = scalargejoinsel
+);
+
+CREATE OPERATOR = (
+    rightarg = int8,
+    leftarg = uint2,
+    procedure = uint2int8eq,
+    commutator = =,
+    negator = <>,
+    restrict = eqsel,
+    join = eqjoinsel,
+    hashes
+);
+
+CREATE OPERATOR <> (
+    rightarg = int8,
+    leftarg = uint2,
+    procedure = uint2int8ne,
+    commutator = <>,
+    negator = =,
+    restrict = neqsel,
+    join = neqjoinsel
+);
+
+-- INT 8/UINT 2 operators
+
+CREATE FUNCTION int8uint2eq(int8, uint2) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION int8uint2ne(int8, uint2) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION int8uint2lt(int8, uint2) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION int8uint2le(int8, uint2) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION int8uint2gt(int8, uint2) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION int8uint2ge(int8, uint2) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION int8uint2_cmp(int8, uint2) RETURNS INTEGER
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE OPERATOR > (
+    rightarg = uint2,
+    leftarg = int8,
+    procedure = int8uint2gt,
+    commutator = <,
+    negator = <=,
+    restrict = uint_scalargtsel,
+    join = scalargtjoinsel
+);
+
+CREATE OPERATOR < (
+    rightarg = uint2,
+    leftarg = int8,
+    procedure = int8uint2lt,
+    commutator = >,
+    negator = >=,
+    restrict = uint_scalarltsel,
+    join = scalarltjoinsel
+);
+
+CREATE OPERATOR <= (
+    rightarg = uint2,
+    leftarg = int8,
+    procedure = int8uint2le,
+    commutator = >=,
+    negator = >,
+    restrict = uint_scalarlesel,
+    join = scalarlejoinsel
+);
+
+CREATE OPERATOR >= (
+    rightarg = uint2,
+    leftarg = int8,
+    procedure = int8uint2ge,
+    commutator = <=,
+    negator = <,
+    restrict = uint_scalargesel,
+    join = scalargejoinsel
+);
+
+CREATE OPERATOR = (
+    rightarg = uint2,
+    leftarg = int8,
+    procedure = int8uint2eq,
+    commutator = =,
+    negator = <>,
+    restrict = eqsel,
+    join = eqjoinsel,
+    hashes
+);
+
+CREATE OPERATOR <> (
+    rightarg = uint2,
+    leftarg = int8,
+    procedure = int8uint2ne,
+    commutator = <>,
+    negator = =,
+    restrict = neqsel,
+    join = neqjoinsel
+);
+
+-- UINT 4/INT 2 operators
+
+CREATE FUNCTION uint4int2eq(uint4, int2) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint4int2ne(uint4, int2) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint4int2lt(uint4, int2) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint4int2le(uint4, int2) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint4int2gt(uint4, int2) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint4int2ge(uint4, int2) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint4int2_cmp(uint4, int2) RETURNS INTEGER
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE OPERATOR > (
+    rightarg = int2,
+    leftarg = uint4,
+    procedure = uint4int2gt,
+    commutator = <,
+    negator = <=,
+    restrict = uint_scalargtsel,
+    join = scalargtjoinsel
+);
+
+CREATE OPERATOR < (
+    rightarg = int2,
+    leftarg = uint4,
+    procedure = uint4int2lt,
+    commutator = >,
+    negator = >=,
+    restrict = uint_scalarltsel,
+    join = scalarltjoinsel
+);
+
+CREATE OPERATOR <= (
+    rightarg = int2,
+    leftarg = uint4,
+    procedure = uint4int2le,
+    commutator = >=,
+    negator = >,
+    restrict = uint_scalarlesel,
+    join = scalarlejoinsel
+);
+
+CREATE OPERATOR >= (
+    rightarg = int2,
+    leftarg = uint4,
+    procedure = uint4int2ge,
+    commutator = <=,
+    negator = <,
+    restrict = uint_scalargesel,
+    join = scalargejoinsel
+);
+
+CREATE OPERATOR = (
+    rightarg = int2,
+    leftarg = uint4,
+    procedure = uint4int2eq,
+    commutator = =,
+    negator = <>,
+    restrict = eqsel,
+    join = eqjoinsel,
+    hashes
+);
+
+CREATE OPERATOR <> (
+    rightarg = int2,
+    leftarg = uint4,
+    procedure = uint4int2ne,
+    commutator = <>,
+    negator = =,
+    restrict = neqsel,
+    join = neqjoinsel
+);
+
+-- INT 2/UINT 4 operators
+
+CREATE FUNCTION int2uint4eq(int2, uint4) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION int2uint4ne(int2, uint4) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION int2uint4lt(int2, uint4) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION int2uint4le(int2, uint4) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION int2uint4gt(int2, uint4) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION int2uint4ge(int2, uint4) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION int2uint4_cmp(int2, uint4) RETURNS INTEGER
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE OPERATOR > (
+    rightarg = uint4,
+    leftarg = int2,
+    procedure = int2uint4gt,
+    commutator = <,
+    negator = <=,
+    restrict = uint_scalargtsel,
+    join = scalargtjoinsel
+);
+
+CREATE OPERATOR < (
+    rightarg = uint4,
+    leftarg = int2,
+    procedure = int2uint4lt,
+    commutator = >,
+    negator = >=,
+    restrict = uint_scalarltsel,
+    join = scalarltjoinsel
+);
+
+CREATE OPERATOR <= (
+    rightarg = uint4,
+    leftarg = int2,
+    procedure = int2uint4le,
+    commutator = >=,
+    negator = >,
+    restrict = uint_scalarlesel,
+    join = scalarlejoinsel
+);
+
+CREATE OPERATOR >= (
+    rightarg = uint4,
+    leftarg = int2,
+    procedure = int2uint4ge,
+    commutator = <=,
+    negator = <,
+    restrict = uint_scalargesel,
+    join = scalargejoinsel
+);
+
+CREATE OPERATOR = (
+    rightarg = uint4,
+    leftarg = int2,
+    procedure = int2uint4eq,
+    commutator = =,
+    negator = <>,
+    restrict = eqsel,
+    join = eqjoinsel,
+    hashes
+);
+
+CREATE OPERATOR <> (
+    rightarg = uint4,
+    leftarg = int2,
+    procedure = int2uint4ne,
+    commutator = <>,
+    negator = =,
+    restrict = neqsel,
+    join = neqjoinsel
+);
+
+-- UINT 4/INT 4 operators
+
+CREATE FUNCTION uint4int4eq(uint4, int4) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint4int4ne(uint4, int4) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint4int4lt(uint4, int4) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint4int4le(uint4, int4) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint4int4gt(uint4, int4) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint4int4ge(uint4, int4) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint4int4_cmp(uint4, int4) RETURNS INTEGER
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE OPERATOR > (
+    rightarg = int4,
+    leftarg = uint4,
+    procedure = uint4int4gt,
+    commutator = <,
+    negator = <=,
+    restrict = uint_scalargtsel,
+    join = scalargtjoinsel
+);
+
+CREATE OPERATOR < (
+    rightarg = int4,
+    leftarg = uint4,
+    procedure = uint4int4lt,
+    commutator = >,
+    negator = >=,
+    restrict = uint_scalarltsel,
+    join = scalarltjoinsel
+);
+
+CREATE OPERATOR <= (
+    rightarg = int4,
+    leftarg = uint4,
+    procedure = uint4int4le,
+    commutator = >=,
+    negator = >,
+    restrict = uint_scalarlesel,
+    join = scalarlejoinsel
+);
+
+CREATE OPERATOR >= (
+    rightarg = int4,
+    leftarg = uint4,
+    procedure = uint4int4ge,
+    commutator = <=,
+    negator = <,
+    restrict = uint_scalargesel,
+    join = scalargejoinsel
+);
+
+CREATE OPERATOR = (
+    rightarg = int4,
+    leftarg = uint4,
+    procedure = uint4int4eq,
+    commutator = =,
+    negator = <>,
+    restrict = eqsel,
+    join = eqjoinsel,
+    hashes
+);
+
+CREATE OPERATOR <> (
+    rightarg = int4,
+    leftarg = uint4,
+    procedure = uint4int4ne,
+    commutator = <>,
+    negator = =,
+    restrict = neqsel,
+    join = neqjoinsel
+);
+
+-- INT 4/UINT 4 operators
+
+CREATE FUNCTION int4uint4eq(int4, uint4) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION int4uint4ne(int4, uint4) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION int4uint4lt(int4, uint4) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION int4uint4le(int4, uint4) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION int4uint4gt(int4, uint4) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION int4uint4ge(int4, uint4) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION int4uint4_cmp(int4, uint4) RETURNS INTEGER
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE OPERATOR > (
+    rightarg = uint4,
+    leftarg = int4,
+    procedure = int4uint4gt,
+    commutator = <,
+    negator = <=,
+    restrict = uint_scalargtsel,
+    join = scalargtjoinsel
+);
+
+CREATE OPERATOR < (
+    rightarg = uint4,
+    leftarg = int4,
+    procedure = int4uint4lt,
+    commutator = >,
+    negator = >=,
+    restrict = uint_scalarltsel,
+    join = scalarltjoinsel
+);
+
+CREATE OPERATOR <= (
+    rightarg = uint4,
+    leftarg = int4,
+    procedure = int4uint4le,
+    commutator = >=,
+    negator = >,
+    restrict = uint_scalarlesel,
+    join = scalarlejoinsel
+);
+
+CREATE OPERATOR >= (
+    rightarg = uint4,
+    leftarg = int4,
+    procedure = int4uint4ge,
+    commutator = <=,
+    negator = <,
+    restrict = uint_scalargesel,
+    join = scalargejoinsel
+);
+
+CREATE OPERATOR = (
+    rightarg = uint4,
+    leftarg = int4,
+    procedure = int4uint4eq,
+    commutator = =,
+    negator = <>,
+    restrict = eqsel,
+    join = eqjoinsel,
+    hashes
+);
+
+CREATE OPERATOR <> (
+    rightarg = uint4,
+    leftarg = int4,
+    procedure = int4uint4ne,
+    commutator = <>,
+    negator = =,
+    restrict = neqsel,
+    join = neqjoinsel
+);
+
+-- UINT 4/INT 8 operators
+
+CREATE FUNCTION uint4int8eq(uint4, int8) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint4int8ne(uint4, int8) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint4int8lt(uint4, int8) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint4int8le(uint4, int8) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint4int8gt(uint4, int8) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint4int8ge(uint4, int8) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint4int8_cmp(uint4, int8) RETURNS INTEGER
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE OPERATOR > (
+    rightarg = int8,
+    leftarg = uint4,
+    procedure = uint4int8gt,
+    commutator = <,
+    negator = <=,
+    restrict = uint_scalargtsel,
+    join = scalargtjoinsel
+);
+
+CREATE OPERATOR < (
+    rightarg = int8,
+    leftarg = uint4,
+    procedure = uint4int8lt,
+    commutator = >,
+    negator = >=,
+    restrict = uint_scalarltsel,
+    join = scalarltjoinsel
+);
+
+CREATE OPERATOR <= (
+    rightarg = int8,
+    leftarg = uint4,
+    procedure = uint4int8le,
+    commutator = >=,
+    negator = >,
+    restrict = uint_scalarlesel,
+    join = scalarlejoinsel
+);
+
+CREATE OPERATOR >= (
+    rightarg = int8,
+    leftarg = uint4,
+    procedure = uint4int8ge,
+    commutator = <=,
+    negator = <,
+    restrict = uint_scalargesel,
+    join = scalargejoinsel
+);
+
+CREATE OPERATOR = (
+    rightarg = int8,
+    leftarg = uint4,
+    procedure = uint4int8eq,
+    commutator = =,
+    negator = <>,
+    restrict = eqsel,
+    join = eqjoinsel,
+    hashes
+);
+
+CREATE OPERATOR <> (
+    rightarg = int8,
+    leftarg = uint4,
+    procedure = uint4int8ne,
+    commutator = <>,
+    negator = =,
+    restrict = neqsel,
+    join = neqjoinsel
+);
+
+-- INT 8/UINT 4 operators
+
+CREATE FUNCTION int8uint4eq(int8, uint4) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION int8uint4ne(int8, uint4) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION int8uint4lt(int8, uint4) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION int8uint4le(int8, uint4) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION int8uint4gt(int8, uint4) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION int8uint4ge(int8, uint4) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION int8uint4_cmp(int8, uint4) RETURNS INTEGER
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE OPERATOR > (
+    rightarg = uint4,
+    leftarg = int8,
+    procedure = int8uint4gt,
+    commutator = <,
+    negator = <=,
+    restrict = uint_scalargtsel,
+    join = scalargtjoinsel
+);
+
+CREATE OPERATOR < (
+    rightarg = uint4,
+    leftarg = int8,
+    procedure = int8uint4lt,
+    commutator = >,
+    negator = >=,
+    restrict = uint_scalarltsel,
+    join = scalarltjoinsel
+);
+
+CREATE OPERATOR <= (
+    rightarg = uint4,
+    leftarg = int8,
+    procedure = int8uint4le,
+    commutator = >=,
+    negator = >,
+    restrict = uint_scalarlesel,
+    join = scalarlejoinsel
+);
+
+CREATE OPERATOR >= (
+    rightarg = uint4,
+    leftarg = int8,
+    procedure = int8uint4ge,
+    commutator = <=,
+    negator = <,
+    restrict = uint_scalargesel,
+    join = scalargejoinsel
+);
+
+CREATE OPERATOR = (
+    rightarg = uint4,
+    leftarg = int8,
+    procedure = int8uint4eq,
+    commutator = =,
+    negator = <>,
+    restrict = eqsel,
+    join = eqjoinsel,
+    hashes
+);
+
+CREATE OPERATOR <> (
+    rightarg = uint4,
+    leftarg = int8,
+    procedure = int8uint4ne,
+    commutator = <>,
+    negator = =,
+    restrict = neqsel,
+    join = neqjoinsel
+);
+
+-- UINT 8/INT 2 operators
+
+CREATE FUNCTION uint8int2eq(uint8, int2) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint8int2ne(uint8, int2) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint8int2lt(uint8, int2) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint8int2le(uint8, int2) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint8int2gt(uint8, int2) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint8int2ge(uint8, int2) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint8int2_cmp(uint8, int2) RETURNS INTEGER
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE OPERATOR > (
+    rightarg = int2,
+    leftarg = uint8,
+    procedure = uint8int2gt,
+    commutator = <,
+    negator = <=,
+    restrict = uint_scalargtsel,
+    join = scalargtjoinsel
+);
+
+CREATE OPERATOR < (
+    rightarg = int2,
+    leftarg = uint8,
+    procedure = uint8int2lt,
+    commutator = >,
+    negator = >=,
+    restrict = uint_scalarltsel,
+    join = scalarltjoinsel
+);
+
+CREATE OPERATOR <= (
+    rightarg = int2,
+    leftarg = uint8,
+    procedure = uint8int2le,
+    commutator = >=,
+    negator = >,
+    restrict = uint_scalarlesel,
+    join = scalarlejoinsel
+);
+
+CREATE OPERATOR >= (
+    rightarg = int2,
+    leftarg = uint8,
+    procedure = uint8int2ge,
+    commutator = <=,
+    negator = <,
+    restrict = uint_scalargesel,
+    join = scalargejoinsel
+);
+
+CREATE OPERATOR = (
+    rightarg = int2,
+    leftarg = uint8,
+    procedure = uint8int2eq,
+    commutator = =,
+    negator = <>,
+    restrict = eqsel,
+    join = eqjoinsel,
+    hashes
+);
+
+CREATE OPERATOR <> (
+    rightarg = int2,
+    leftarg = uint8,
+    procedure = uint8int2ne,
+    commutator = <>,
+    negator = =,
+    restrict = neqsel,
+    join = neqjoinsel
+);
+
+-- INT 2/UINT 8 operators
+
+CREATE FUNCTION int2uint8eq(int2, uint8) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION int2uint8ne(int2, uint8) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION int2uint8lt(int2, uint8) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION int2uint8le(int2, uint8) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION int2uint8gt(int2, uint8) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION int2uint8ge(int2, uint8) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION int2uint8_cmp(int2, uint8) RETURNS INTEGER
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE OPERATOR > (
+    rightarg = uint8,
+    leftarg = int2,
+    procedure = int2uint8gt,
+    commutator = <,
+    negator = <=,
+    restrict = uint_scalargtsel,
+    join = scalargtjoinsel
+);
+
+CREATE OPERATOR < (
+    rightarg = uint8,
+    leftarg = int2,
+    procedure = int2uint8lt,
+    commutator = >,
+    negator = >=,
+    restrict = uint_scalarltsel,
+    join = scalarltjoinsel
+);
+
+CREATE OPERATOR <= (
+    rightarg = uint8,
+    leftarg = int2,
+    procedure = int2uint8le,
+    commutator = >=,
+    negator = >,
+    restrict = uint_scalarlesel,
+    join = scalarlejoinsel
+);
+
+CREATE OPERATOR >= (
+    rightarg = uint8,
+    leftarg = int2,
+    procedure = int2uint8ge,
+    commutator = <=,
+    negator = <,
+    restrict = uint_scalargesel,
+    join = scalargejoinsel
+);
+
+CREATE OPERATOR = (
+    rightarg = uint8,
+    leftarg = int2,
+    procedure = int2uint8eq,
+    commutator = =,
+    negator = <>,
+    restrict = eqsel,
+    join = eqjoinsel,
+    hashes
+);
+
+CREATE OPERATOR <> (
+    rightarg = uint8,
+    leftarg = int2,
+    procedure = int2uint8ne,
+    commutator = <>,
+    negator = =,
+    restrict = neqsel,
+    join = neqjoinsel
+);
+
+-- UINT 8/INT 4 operators
+
+CREATE FUNCTION uint8int4eq(uint8, int4) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint8int4ne(uint8, int4) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint8int4lt(uint8, int4) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint8int4le(uint8, int4) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint8int4gt(uint8, int4) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint8int4ge(uint8, int4) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint8int4_cmp(uint8, int4) RETURNS INTEGER
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE OPERATOR > (
+    rightarg = int4,
+    leftarg = uint8,
+    procedure = uint8int4gt,
+    commutator = <,
+    negator = <=,
+    restrict = uint_scalargtsel,
+    join = scalargtjoinsel
+);
+
+CREATE OPERATOR < (
+    rightarg = int4,
+    leftarg = uint8,
+    procedure = uint8int4lt,
+    commutator = >,
+    negator = >=,
+    restrict = uint_scalarltsel,
+    join = scalarltjoinsel
+);
+
+CREATE OPERATOR <= (
+    rightarg = int4,
+    leftarg = uint8,
+    procedure = uint8int4le,
+    commutator = >=,
+    negator = >,
+    restrict = uint_scalarlesel,
+    join = scalarlejoinsel
+);
+
+CREATE OPERATOR >= (
+    rightarg = int4,
+    leftarg = uint8,
+    procedure = uint8int4ge,
+    commutator = <=,
+    negator = <,
+    restrict = uint_scalargesel,
+    join = scalargejoinsel
+);
+
+CREATE OPERATOR = (
+    rightarg = int4,
+    leftarg = uint8,
+    procedure = uint8int4eq,
+    commutator = =,
+    negator = <>,
+    restrict = eqsel,
+    join = eqjoinsel,
+    hashes
+);
+
+CREATE OPERATOR <> (
+    rightarg = int4,
+    leftarg = uint8,
+    procedure = uint8int4ne,
+    commutator = <>,
+    negator = =,
+    restrict = neqsel,
+    join = neqjoinsel
+);
+
+-- INT 4/UINT 8 operators
+
+CREATE FUNCTION int4uint8eq(int4, uint8) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION int4uint8ne(int4, uint8) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION int4uint8lt(int4, uint8) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION int4uint8le(int4, uint8) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION int4uint8gt(int4, uint8) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION int4uint8ge(int4, uint8) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION int4uint8_cmp(int4, uint8) RETURNS INTEGER
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE OPERATOR > (
+    rightarg = uint8,
+    leftarg = int4,
+    procedure = int4uint8gt,
+    commutator = <,
+    negator = <=,
+    restrict = uint_scalargtsel,
+    join = scalargtjoinsel
+);
+
+CREATE OPERATOR < (
+    rightarg = uint8,
+    leftarg = int4,
+    procedure = int4uint8lt,
+    commutator = >,
+    negator = >=,
+    restrict = uint_scalarltsel,
+    join = scalarltjoinsel
+);
+
+CREATE OPERATOR <= (
+    rightarg = uint8,
+    leftarg = int4,
+    procedure = int4uint8le,
+    commutator = >=,
+    negator = >,
+    restrict = uint_scalarlesel,
+    join = scalarlejoinsel
+);
+
+CREATE OPERATOR >= (
+    rightarg = uint8,
+    leftarg = int4,
+    procedure = int4uint8ge,
+    commutator = <=,
+    negator = <,
+    restrict = uint_scalargesel,
+    join = scalargejoinsel
+);
+
+CREATE OPERATOR = (
+    rightarg = uint8,
+    leftarg = int4,
+    procedure = int4uint8eq,
+    commutator = =,
+    negator = <>,
+    restrict = eqsel,
+    join = eqjoinsel,
+    hashes
+);
+
+CREATE OPERATOR <> (
+    rightarg = uint8,
+    leftarg = int4,
+    procedure = int4uint8ne,
+    commutator = <>,
+    negator = =,
+    restrict = neqsel,
+    join = neqjoinsel
+);
+
+-- UINT 8/INT 8 operators
+
+CREATE FUNCTION uint8int8eq(uint8, int8) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint8int8ne(uint8, int8) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint8int8lt(uint8, int8) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint8int8le(uint8, int8) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint8int8gt(uint8, int8) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint8int8ge(uint8, int8) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint8int8_cmp(uint8, int8) RETURNS INTEGER
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE OPERATOR > (
+    rightarg = int8,
+    leftarg = uint8,
+    procedure = uint8int8gt,
+    commutator = <,
+    negator = <=,
+    restrict = uint_scalargtsel,
+    join = scalargtjoinsel
+);
+
+CREATE OPERATOR < (
+    rightarg = int8,
+    leftarg = uint8,
+    procedure = uint8int8lt,
+    commutator = >,
+    negator = >=,
+    restrict = uint_scalarltsel,
+    join = scalarltjoinsel
+);
+
+CREATE OPERATOR <= (
+    rightarg = int8,
+    leftarg = uint8,
+    procedure = uint8int8le,
+    commutator = >=,
+    negator = >,
+    restrict = uint_scalarlesel,
+    join = scalarlejoinsel
+);
+
+CREATE OPERATOR >= (
+    rightarg = int8,
+    leftarg = uint8,
+    procedure = uint8int8ge,
+    commutator = <=,
+    negator = <,
+    restrict = uint_scalargesel,
+    join = scalargejoinsel
+);
+
+CREATE OPERATOR = (
+    rightarg = int8,
+    leftarg = uint8,
+    procedure = uint8int8eq,
+    commutator = =,
+    negator = <>,
+    restrict = eqsel,
+    join = eqjoinsel,
+    hashes
+);
+
+CREATE OPERATOR <> (
+    rightarg = int8,
+    leftarg = uint8,
+    procedure = uint8int8ne,
+    commutator = <>,
+    negator = =,
+    restrict = neqsel,
+    join = neqjoinsel
+);
+
+-- INT 8/UINT 8 operators
+
+CREATE FUNCTION int8uint8eq(int8, uint8) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION int8uint8ne(int8, uint8) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION int8uint8lt(int8, uint8) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION int8uint8le(int8, uint8) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION int8uint8gt(int8, uint8) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION int8uint8ge(int8, uint8) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION int8uint8_cmp(int8, uint8) RETURNS INTEGER
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE OPERATOR > (
+    rightarg = uint8,
+    leftarg = int8,
+    procedure = int8uint8gt,
+    commutator = <,
+    negator = <=,
+    restrict = uint_scalargtsel,
+    join = scalargtjoinsel
+);
+
+CREATE OPERATOR < (
+    rightarg = uint8,
+    leftarg = int8,
+    procedure = int8uint8lt,
+    commutator = >,
+    negator = >=,
+    restrict = uint_scalarltsel,
+    join = scalarltjoinsel
+);
+
+CREATE OPERATOR <= (
+    rightarg = uint8,
+    leftarg = int8,
+    procedure = int8uint8le,
+    commutator = >=,
+    negator = >,
+    restrict = uint_scalarlesel,
+    join = scalarlejoinsel
+);
+
+CREATE OPERATOR >= (
+    rightarg = uint8,
+    leftarg = int8,
+    procedure = int8uint8ge,
+    commutator = <=,
+    negator = <,
+    restrict = uint_scalargesel,
+    join = scalargejoinsel
+);
+
+CREATE OPERATOR = (
+    rightarg = uint8,
+    leftarg = int8,
+    procedure = int8uint8eq,
+    commutator = =,
+    negator = <>,
+    restrict = eqsel,
+    join = eqjoinsel,
+    hashes
+);
+
+CREATE OPERATOR <> (
+    rightarg = uint8,
+    leftarg = int8,
+    procedure = int8uint8ne,
+    commutator = <>,
+    negator = =,
+    restrict = neqsel,
+    join = neqjoinsel
+);
+
+-- Unsigned cross-type comparators
+
+CREATE FUNCTION uint24_cmp(uint2, uint4) RETURNS INTEGER
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint42_cmp(uint4, uint2) RETURNS INTEGER
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint28_cmp(uint2, uint8) RETURNS INTEGER
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint82_cmp(uint8, uint2) RETURNS INTEGER
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint48_cmp(uint4, uint8) RETURNS INTEGER
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint84_cmp(uint8, uint4) RETURNS INTEGER
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+-- The uint2/uint4 equality operators predate the hash families' cross-type
+-- members; see above for why older servers update the catalog directly.
+DO $$
+BEGIN
+    IF current_setting('server_version_num')::int >= 170000 THEN
+        ALTER OPERATOR = (uint2, uint4) SET (HASHES);
+        ALTER OPERATOR = (uint4, uint2) SET (HASHES);
+    ELSE
+        UPDATE pg_catalog.pg_operator SET oprcanhash = true
+        WHERE oid IN ('=(uint2, uint4)'::pg_catalog.regoperator,
+                      '=(uint4, uint2)'::pg_catalog.regoperator);
+    END IF;
+END
+$$;
+
+-- Family members
+
+ALTER OPERATOR FAMILY uint2_ops_btree USING btree ADD
+        OPERATOR        1       < (uint2, uint4),
+        OPERATOR        2       <= (uint2, uint4),
+        OPERATOR        3       = (uint2, uint4),
+        OPERATOR        4       >= (uint2, uint4),
+        OPERATOR        5       > (uint2, uint4),
+        FUNCTION        1       (uint2, uint4) uint24_cmp(uint2, uint4),
+        OPERATOR        1       < (uint2, uint8),
+        OPERATOR        2       <= (uint2, uint8),
+        OPERATOR        3       = (uint2, uint8),
+        OPERATOR        4       >= (uint2, uint8),
+        OPERATOR        5       > (uint2, uint8),
+        FUNCTION        1       (uint2, uint8) uint28_cmp(uint2, uint8),
+        OPERATOR        1       < (uint2, int2),
+        OPERATOR        2       <= (uint2, int2),
+        OPERATOR        3       = (uint2, int2),
+        OPERATOR        4       >= (uint2, int2),
+        OPERATOR        5       > (uint2, int2),
+        FUNCTION        1       (uint2, int2) uint2int2_cmp(uint2, int2),
+        OPERATOR        1       < (uint2, int4),
+        OPERATOR        2       <= (uint2, int4),
+        OPERATOR        3       = (uint2, int4),
+        OPERATOR        4       >= (uint2, int4),
+        OPERATOR        5       > (uint2, int4),
+        FUNCTION        1       (uint2, int4) uint2int4_cmp(uint2, int4),
+        OPERATOR        1       < (uint2, int8),
+        OPERATOR        2       <= (uint2, int8),
+        OPERATOR        3       = (uint2, int8),
+        OPERATOR        4       >= (uint2, int8),
+        OPERATOR        5       > (uint2, int8),
+        FUNCTION        1       (uint2, int8) uint2int8_cmp(uint2, int8),
+        OPERATOR        1       < (int2, uint2),
+        OPERATOR        2       <= (int2, uint2),
+        OPERATOR        3       = (int2, uint2),
+        OPERATOR        4       >= (int2, uint2),
+        OPERATOR        5       > (int2, uint2),
+        FUNCTION        1       (int2, uint2) int2uint2_cmp(int2, uint2),
+        OPERATOR        1       < (int4, uint2),
+        OPERATOR        2       <= (int4, uint2),
+        OPERATOR        3       = (int4, uint2),
+        OPERATOR        4       >= (int4, uint2),
+        OPERATOR        5       > (int4, uint2),
+        FUNCTION        1       (int4, uint2) int4uint2_cmp(int4, uint2),
+        OPERATOR        1       < (int8, uint2),
+        OPERATOR        2       <= (int8, uint2),
+        OPERATOR        3       = (int8, uint2),
+        OPERATOR        4       >= (int8, uint2),
+        OPERATOR        5       > (int8, uint2),
+        FUNCTION        1       (int8, uint2) int8uint2_cmp(int8, uint2);
+
+ALTER OPERATOR FAMILY uint4_ops_btree USING btree ADD
+        OPERATOR        1       < (uint4, uint2),
+        OPERATOR        2       <= (uint4, uint2),
+        OPERATOR        3       = (uint4, uint2),
+        OPERATOR        4       >= (uint4, uint2),
+        OPERATOR        5       > (uint4, uint2),
+        FUNCTION        1       (uint4, uint2) uint42_cmp(uint4, uint2),
+        OPERATOR        1       < (uint4, uint8),
+        OPERATOR        2       <= (uint4, uint8),
+        OPERATOR        3       = (uint4, uint8),
+        OPERATOR        4       >= (uint4, uint8),
+        OPERATOR        5       > (uint4, uint8),
+        FUNCTION        1       (uint4, uint8) uint48_cmp(uint4, uint8),
+        OPERATOR        1       < (uint4, int2),
+        OPERATOR        2       <= (uint4, int2),
+        OPERATOR        3       = (uint4, int2),
+        OPERATOR        4       >= (uint4, int2),
+        OPERATOR        5       > (uint4, int2),
+        FUNCTION        1       (uint4, int2) uint4int2_cmp(uint4, int2),
+        OPERATOR        1       < (uint4, int4),
+        OPERATOR        2       <= (uint4, int4),
+        OPERATOR        3       = (uint4, int4),
+        OPERATOR        4       >= (uint4, int4),
+        OPERATOR        5       > (uint4, int4),
+        FUNCTION        1       (uint4, int4) uint4int4_cmp(uint4, int4),
+        OPERATOR        1       < (uint4, int8),
+        OPERATOR        2       <= (uint4, int8),
+        OPERATOR        3       = (uint4, int8),
+        OPERATOR        4       >= (uint4, int8),
+        OPERATOR        5       > (uint4, int8),
+        FUNCTION        1       (uint4, int8) uint4int8_cmp(uint4, int8),
+        OPERATOR        1       < (int2, uint4),
+        OPERATOR        2       <= (int2, uint4),
+        OPERATOR        3       = (int2, uint4),
+        OPERATOR        4       >= (int2, uint4),
+        OPERATOR        5       > (int2, uint4),
+        FUNCTION        1       (int2, uint4) int2uint4_cmp(int2, uint4),
+        OPERATOR        1       < (int4, uint4),
+        OPERATOR        2       <= (int4, uint4),
+        OPERATOR        3       = (int4, uint4),
+        OPERATOR        4       >= (int4, uint4),
+        OPERATOR        5       > (int4, uint4),
+        FUNCTION        1       (int4, uint4) int4uint4_cmp(int4, uint4),
+        OPERATOR        1       < (int8, uint4),
+        OPERATOR        2       <= (int8, uint4),
+        OPERATOR        3       = (int8, uint4),
+        OPERATOR        4       >= (int8, uint4),
+        OPERATOR        5       > (int8, uint4),
+        FUNCTION        1       (int8, uint4) int8uint4_cmp(int8, uint4);
+
+ALTER OPERATOR FAMILY uint8_ops_btree USING btree ADD
+        OPERATOR        1       < (uint8, uint2),
+        OPERATOR        2       <= (uint8, uint2),
+        OPERATOR        3       = (uint8, uint2),
+        OPERATOR        4       >= (uint8, uint2),
+        OPERATOR        5       > (uint8, uint2),
+        FUNCTION        1       (uint8, uint2) uint82_cmp(uint8, uint2),
+        OPERATOR        1       < (uint8, uint4),
+        OPERATOR        2       <= (uint8, uint4),
+        OPERATOR        3       = (uint8, uint4),
+        OPERATOR        4       >= (uint8, uint4),
+        OPERATOR        5       > (uint8, uint4),
+        FUNCTION        1       (uint8, uint4) uint84_cmp(uint8, uint4),
+        OPERATOR        1       < (uint8, int2),
+        OPERATOR        2       <= (uint8, int2),
+        OPERATOR        3       = (uint8, int2),
+        OPERATOR        4       >= (uint8, int2),
+        OPERATOR        5       > (uint8, int2),
+        FUNCTION        1       (uint8, int2) uint8int2_cmp(uint8, int2),
+        OPERATOR        1       < (uint8, int4),
+        OPERATOR        2       <= (uint8, int4),
+        OPERATOR        3       = (uint8, int4),
+        OPERATOR        4       >= (uint8, int4),
+        OPERATOR        5       > (uint8, int4),
+        FUNCTION        1       (uint8, int4) uint8int4_cmp(uint8, int4),
+        OPERATOR        1       < (uint8, int8),
+        OPERATOR        2       <= (uint8, int8),
+        OPERATOR        3       = (uint8, int8),
+        OPERATOR        4       >= (uint8, int8),
+        OPERATOR        5       > (uint8, int8),
+        FUNCTION        1       (uint8, int8) uint8int8_cmp(uint8, int8),
+        OPERATOR        1       < (int2, uint8),
+        OPERATOR        2       <= (int2, uint8),
+        OPERATOR        3       = (int2, uint8),
+        OPERATOR        4       >= (int2, uint8),
+        OPERATOR        5       > (int2, uint8),
+        FUNCTION        1       (int2, uint8) int2uint8_cmp(int2, uint8),
+        OPERATOR        1       < (int4, uint8),
+        OPERATOR        2       <= (int4, uint8),
+        OPERATOR        3       = (int4, uint8),
+        OPERATOR        4       >= (int4, uint8),
+        OPERATOR        5       > (int4, uint8),
+        FUNCTION        1       (int4, uint8) int4uint8_cmp(int4, uint8),
+        OPERATOR        1       < (int8, uint8),
+        OPERATOR        2       <= (int8, uint8),
+        OPERATOR        3       = (int8, uint8),
+        OPERATOR        4       >= (int8, uint8),
+        OPERATOR        5       > (int8, uint8),
+        FUNCTION        1       (int8, uint8) int8uint8_cmp(int8, uint8);
+
+ALTER OPERATOR FAMILY uint2_ops_hash USING hash ADD
+        OPERATOR        1       = (uint2, uint4),
+        OPERATOR        1       = (uint2, uint8),
+        OPERATOR        1       = (uint2, int2),
+        OPERATOR        1       = (uint2, int4),
+        OPERATOR        1       = (uint2, int8),
+        OPERATOR        1       = (int2, uint2),
+        OPERATOR        1       = (int4, uint2),
+        OPERATOR        1       = (int8, uint2),
+        FUNCTION        1       (uint4) uint4_hash(uint4),
+        FUNCTION        1       (uint8) uint8_hash(uint8),
+        FUNCTION        1       (int2) hashint2(int2),
+        FUNCTION        1       (int4) hashint4(int4),
+        FUNCTION        1       (int8) hashint8(int8);
+
+ALTER OPERATOR FAMILY uint4_ops_hash USING hash ADD
+        OPERATOR        1       = (uint4, uint2),
+        OPERATOR        1       = (uint4, uint8),
+        OPERATOR        1       = (uint4, int2),
+        OPERATOR        1       = (uint4, int4),
+        OPERATOR        1       = (uint4, int8),
+        OPERATOR        1       = (int2, uint4),
+        OPERATOR        1       = (int4, uint4),
+        OPERATOR        1       = (int8, uint4),
+        FUNCTION        1       (uint2) uint2_hash(uint2),
+        FUNCTION        1       (uint8) uint8_hash(uint8),
+        FUNCTION        1       (int2) hashint2(int2),
+        FUNCTION        1       (int4) hashint4(int4),
+        FUNCTION        1       (int8) hashint8(int8);
+
+ALTER OPERATOR FAMILY uint8_ops_hash USING hash ADD
+        OPERATOR        1       = (uint8, uint2),
+        OPERATOR        1       = (uint8, uint4),
+        OPERATOR        1       = (uint8, int2),
+        OPERATOR        1       = (uint8, int4),
+        OPERATOR        1       = (uint8, int8),
+        OPERATOR        1       = (int2, uint8),
+        OPERATOR        1       = (int4, uint8),
+        OPERATOR        1       = (int8, uint8),
+        FUNCTION        1       (uint2) uint2_hash(uint2),
+        FUNCTION        1       (uint4) uint4_hash(uint4),
+        FUNCTION        1       (int2) hashint2(int2),
+        FUNCTION        1       (int4) hashint4(int4),
+        FUNCTION        1       (int8) hashint8(int8);
+
+
+-- BRIN operator classes
+--
+-- The core minmax, minmax-multi and bloom support procedures work for any
+-- type whose operators are in the family.  The minmax families also get the
+-- cross-type operators, so that e.g. "seq > 5" can be used to skip ranges.
+
+CREATE FUNCTION uint2_minmax_multi_distance(internal, internal) RETURNS float8
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint4_minmax_multi_distance(internal, internal) RETURNS float8
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint8_minmax_multi_distance(internal, internal) RETURNS float8
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE OPERATOR CLASS uint2_minmax_ops
+    DEFAULT FOR TYPE uint2 USING brin AS
+        OPERATOR        1       < ,
+        OPERATOR        2       <= ,
+        OPERATOR        3       = ,
+        OPERATOR        4       >= ,
+        OPERATOR        5       > ,
+        FUNCTION        1       brin_minmax_opcinfo(internal),
+        FUNCTION        2       brin_minmax_add_value(internal, internal, internal, internal),
+        FUNCTION        3       brin_minmax_consistent(internal, internal, internal),
+        FUNCTION        4       brin_minmax_union(internal, internal, internal);
+
+CREATE OPERATOR CLASS uint2_minmax_multi_ops
+    FOR TYPE uint2 USING brin AS
+        OPERATOR        1       < ,
+        OPERATOR        2       <= ,
+        OPERATOR        3       = ,
+        OPERATOR        4       >= ,
+        OPERATOR        5       > ,
+        FUNCTION        1       brin_minmax_multi_opcinfo(internal),
+        FUNCTION        2       brin_minmax_multi_add_value(internal, internal, internal, internal),
+        FUNCTION        3       brin_minmax_multi_consistent(internal, internal, internal, integer),
+        FUNCTION        4       brin_minmax_multi_union(internal, internal, internal),
+        FUNCTION        5       brin_minmax_multi_options(internal),
+        FUNCTION        11      uint2_minmax_multi_distance(internal, internal);
+
+CREATE OPERATOR CLASS uint2_bloom_ops
+    FOR TYPE uint2 USING brin AS
+        OPERATOR        1       = ,
+        FUNCTION        1       brin_bloom_opcinfo(internal),
+        FUNCTION        2       brin_bloom_add_value(internal, internal, internal, internal),
+        FUNCTION        3       brin_bloom_consistent(internal, internal, internal, integer),
+        FUNCTION        4       brin_bloom_union(internal, internal, internal),
+        FUNCTION        5       brin_bloom_options(internal),
+        FUNCTION        11      uint2_hash(uint2);
+
+CREATE OPERATOR CLASS uint4_minmax_ops
+    DEFAULT FOR TYPE uint4 USING brin AS
+        OPERATOR        1       < ,
+        OPERATOR        2       <= ,
+        OPERATOR        3       = ,
+        OPERATOR        4       >= ,
+        OPERATOR        5       > ,
+        FUNCTION        1       brin_minmax_opcinfo(internal),
+        FUNCTION        2       brin_minmax_add_value(internal, internal, internal, internal),
+        FUNCTION        3       brin_minmax_consistent(internal, internal, internal),
+        FUNCTION        4       brin_minmax_union(internal, internal, internal);
+
+CREATE OPERATOR CLASS uint4_minmax_multi_ops
+    FOR TYPE uint4 USING brin AS
+        OPERATOR        1       < ,
+        OPERATOR        2       <= ,
+        OPERATOR        3       = ,
+        OPERATOR        4       >= ,
+        OPERATOR        5       > ,
+        FUNCTION        1       brin_minmax_multi_opcinfo(internal),
+        FUNCTION        2       brin_minmax_multi_add_value(internal, internal, internal, internal),
+        FUNCTION        3       brin_minmax_multi_consistent(internal, internal, internal, integer),
+        FUNCTION        4       brin_minmax_multi_union(internal, internal, internal),
+        FUNCTION        5       brin_minmax_multi_options(internal),
+        FUNCTION        11      uint4_minmax_multi_distance(internal, internal);
+
+CREATE OPERATOR CLASS uint4_bloom_ops
+    FOR TYPE uint4 USING brin AS
+        OPERATOR        1       = ,
+        FUNCTION        1       brin_bloom_opcinfo(internal),
+        FUNCTION        2       brin_bloom_add_value(internal, internal, internal, internal),
+        FUNCTION        3       brin_bloom_consistent(internal, internal, internal, integer),
+        FUNCTION        4       brin_bloom_union(internal, internal, internal),
+        FUNCTION        5       brin_bloom_options(internal),
+        FUNCTION        11      uint4_hash(uint4);
+
+CREATE OPERATOR CLASS uint8_minmax_ops
+    DEFAULT FOR TYPE uint8 USING brin AS
+        OPERATOR        1       < ,
+        OPERATOR        2       <= ,
+        OPERATOR        3       = ,
+        OPERATOR        4       >= ,
+        OPERATOR        5       > ,
+        FUNCTION        1       brin_minmax_opcinfo(internal),
+        FUNCTION        2       brin_minmax_add_value(internal, internal, internal, internal),
+        FUNCTION        3       brin_minmax_consistent(internal, internal, internal),
+        FUNCTION        4       brin_minmax_union(internal, internal, internal);
+
+CREATE OPERATOR CLASS uint8_minmax_multi_ops
+    FOR TYPE uint8 USING brin AS
+        OPERATOR        1       < ,
+        OPERATOR        2       <= ,
+        OPERATOR        3       = ,
+        OPERATOR        4       >= ,
+        OPERATOR        5       > ,
+        FUNCTION        1       brin_minmax_multi_opcinfo(internal),
+        FUNCTION        2       brin_minmax_multi_add_value(internal, internal, internal, internal),
+        FUNCTION        3       brin_minmax_multi_consistent(internal, internal, internal, integer),
+        FUNCTION        4       brin_minmax_multi_union(internal, internal, internal),
+        FUNCTION        5       brin_minmax_multi_options(internal),
+        FUNCTION        11      uint8_minmax_multi_distance(internal, internal);
+
+CREATE OPERATOR CLASS uint8_bloom_ops
+    FOR TYPE uint8 USING brin AS
+        OPERATOR        1       = ,
+        FUNCTION        1       brin_bloom_opcinfo(internal),
+        FUNCTION        2       brin_bloom_add_value(internal, internal, internal, internal),
+        FUNCTION        3       brin_bloom_consistent(internal, internal, internal, integer),
+        FUNCTION        4       brin_bloom_union(internal, internal, internal),
+        FUNCTION        5       brin_bloom_options(internal),
+        FUNCTION        11      uint8_hash(uint8);
+
+ALTER OPERATOR FAMILY uint2_minmax_ops USING brin ADD
+        OPERATOR        1       < (uint2, uint4),
+        OPERATOR        2       <= (uint2, uint4),
+        OPERATOR        3       = (uint2, uint4),
+        OPERATOR        4       >= (uint2, uint4),
+        OPERATOR        5       > (uint2, uint4),
+        OPERATOR        1       < (uint2, uint8),
+        OPERATOR        2       <= (uint2, uint8),
+        OPERATOR        3       = (uint2, uint8),
+        OPERATOR        4       >= (uint2, uint8),
+        OPERATOR        5       > (uint2, uint8),
+        OPERATOR        1       < (uint2, int2),
+        OPERATOR        2       <= (uint2, int2),
+        OPERATOR        3       = (uint2, int2),
+        OPERATOR        4       >= (uint2, int2),
+        OPERATOR        5       > (uint2, int2),
+        OPERATOR        1       < (uint2, int4),
+        OPERATOR        2       <= (uint2, int4),
+        OPERATOR        3       = (uint2, int4),
+        OPERATOR        4       >= (uint2, int4),
+        OPERATOR        5       > (uint2, int4),
+        OPERATOR        1       < (uint2, int8),
+        OPERATOR        2       <= (uint2, int8),
+        OPERATOR        3       = (uint2, int8),
+        OPERATOR        4       >= (uint2, int8),
+        OPERATOR        5       > (uint2, int8);
+
+ALTER OPERATOR FAMILY uint2_minmax_multi_ops USING brin ADD
+        OPERATOR        1       < (uint2, uint4),
+        OPERATOR        2       <= (uint2, uint4),
+        OPERATOR        3       = (uint2, uint4),
+        OPERATOR        4       >= (uint2, uint4),
+        OPERATOR        5       > (uint2, uint4),
+        OPERATOR        1       < (uint2, uint8),
+        OPERATOR        2       <= (uint2, uint8),
+        OPERATOR        3       = (uint2, uint8),
+        OPERATOR        4       >= (uint2, uint8),
+        OPERATOR        5       > (uint2, uint8),
+        OPERATOR        1       < (uint2, int2),
+        OPERATOR        2       <= (uint2, int2),
+        OPERATOR        3       = (uint2, int2),
+        OPERATOR        4       >= (uint2, int2),
+        OPERATOR        5       > (uint2, int2),
+        OPERATOR        1       < (uint2, int4),
+        OPERATOR        2       <= (uint2, int4),
+        OPERATOR        3       = (uint2, int4),
+        OPERATOR        4       >= (uint2, int4),
+        OPERATOR        5       > (uint2, int4),
+        OPERATOR        1       < (uint2, int8),
+        OPERATOR        2       <= (uint2, int8),
+        OPERATOR        3       = (uint2, int8),
+        OPERATOR        4       >= (uint2, int8),
+        OPERATOR        5       > (uint2, int8);
+
+ALTER OPERATOR FAMILY uint4_minmax_ops USING brin ADD
+        OPERATOR        1       < (uint4, uint2),
+        OPERATOR        2       <= (uint4, uint2),
+        OPERATOR        3       = (uint4, uint2),
+        OPERATOR        4       >= (uint4, uint2),
+        OPERATOR        5       > (uint4, uint2),
+        OPERATOR        1       < (uint4, uint8),
+        OPERATOR        2       <= (uint4, uint8),
+        OPERATOR        3       = (uint4, uint8),
+        OPERATOR        4       >= (uint4, uint8),
+        OPERATOR        5       > (uint4, uint8),
+        OPERATOR        1       < (uint4, int2),
+        OPERATOR        2       <= (uint4, int2),
+        OPERATOR        3       = (uint4, int2),
+        OPERATOR        4       >= (uint4, int2),
+        OPERATOR        5       > (uint4, int2),
+        OPERATOR        1       < (uint4, int4),
+        OPERATOR        2       <= (uint4, int4),
+        OPERATOR        3       = (uint4, int4),
+        OPERATOR        4       >= (uint4, int4),
+        OPERATOR        5       > (uint4, int4),
+        OPERATOR        1       < (uint4, int8),
+        OPERATOR        2       <= (uint4, int8),
+        OPERATOR        3       = (uint4, int8),
+        OPERATOR        4       >= (uint4, int8),
+        OPERATOR        5       > (uint4, int8);
+
+ALTER OPERATOR FAMILY uint4_minmax_multi_ops USING brin ADD
+        OPERATOR        1       < (uint4, uint2),
+        OPERATOR        2       <= (uint4, uint2),
+        OPERATOR        3       = (uint4, uint2),
+        OPERATOR        4       >= (uint4, uint2),
+        OPERATOR        5       > (uint4, uint2),
+        OPERATOR        1       < (uint4, uint8),
+        OPERATOR        2       <= (uint4, uint8),
+        OPERATOR        3       = (uint4, uint8),
+        OPERATOR        4       >= (uint4, uint8),
+        OPERATOR        5       > (uint4, uint8),
+        OPERATOR        1       < (uint4, int2),
+        OPERATOR        2       <= (uint4, int2),
+        OPERATOR        3       = (uint4, int2),
+        OPERATOR        4       >= (uint4, int2),
+        OPERATOR        5       > (uint4, int2),
+        OPERATOR        1       < (uint4, int4),
+        OPERATOR        2       <= (uint4, int4),
+        OPERATOR        3       = (uint4, int4),
+        OPERATOR        4       >= (uint4, int4),
+        OPERATOR        5       > (uint4, int4),
+        OPERATOR        1       < (uint4, int8),
+        OPERATOR        2       <= (uint4, int8),
+        OPERATOR        3       = (uint4, int8),
+        OPERATOR        4       >= (uint4, int8),
+        OPERATOR        5       > (uint4, int8);
+
+ALTER OPERATOR FAMILY uint8_minmax_ops USING brin ADD
+        OPERATOR        1       < (uint8, uint2),
+        OPERATOR        2       <= (uint8, uint2),
+        OPERATOR        3       = (uint8, uint2),
+        OPERATOR        4       >= (uint8, uint2),
+        OPERATOR        5       > (uint8, uint2),
+        OPERATOR        1       < (uint8, uint4),
+        OPERATOR        2       <= (uint8, uint4),
+        OPERATOR        3       = (uint8, uint4),
+        OPERATOR        4       >= (uint8, uint4),
+        OPERATOR        5       > (uint8, uint4),
+        OPERATOR        1       < (uint8, int2),
+        OPERATOR        2       <= (uint8, int2),
+        OPERATOR        3       = (uint8, int2),
+        OPERATOR        4       >= (uint8, int2),
+        OPERATOR        5       > (uint8, int2),
+        OPERATOR        1       < (uint8, int4),
+        OPERATOR        2       <= (uint8, int4),
+        OPERATOR        3       = (uint8, int4),
+        OPERATOR        4       >= (uint8, int4),
+        OPERATOR        5       > (uint8, int4),
+        OPERATOR        1       < (uint8, int8),
+        OPERATOR        2       <= (uint8, int8),
+        OPERATOR        3       = (uint8, int8),
+        OPERATOR        4       >= (uint8, int8),
+        OPERATOR        5       > (uint8, int8);
+
+ALTER OPERATOR FAMILY uint8_minmax_multi_ops USING brin ADD
+        OPERATOR        1       < (uint8, uint2),
+        OPERATOR        2       <= (uint8, uint2),
+        OPERATOR        3       = (uint8, uint2),
+        OPERATOR        4       >= (uint8, uint2),
+        OPERATOR        5       > (uint8, uint2),
+        OPERATOR        1       < (uint8, uint4),
+        OPERATOR        2       <= (uint8, uint4),
+        OPERATOR        3       = (uint8, uint4),
+        OPERATOR        4       >= (uint8, uint4),
+        OPERATOR        5       > (uint8, uint4),
+        OPERATOR        1       < (uint8, int2),
+        OPERATOR        2       <= (uint8, int2),
+        OPERATOR        3       = (uint8, int2),
+        OPERATOR        4       >= (uint8, int2),
+        OPERATOR        5       > (uint8, int2),
+        OPERATOR        1       < (uint8, int4),
+        OPERATOR        2       <= (uint8, int4),
+        OPERATOR        3       = (uint8, int4),
+        OPERATOR        4       >= (uint8, int4),
+        OPERATOR        5       > (uint8, int4),
+        OPERATOR        1       < (uint8, int8),
+        OPERATOR        2       <= (uint8, int8),
+        OPERATOR        3       = (uint8, int8),
+        OPERATOR        4       >= (uint8, int8),
+        OPERATOR        5       > (uint8, int8);
+
+
+-- GiST operator classes
+--
+-- As in btree_gist, index entries hold the range of values below them, which
+-- gives "=" and "<>" for exclusion constraints and "<->" for nearest-neighbour
+-- ordering.  The key type cannot be input or output.
+
+CREATE TYPE uintgistkey;
+
+CREATE FUNCTION uintgistkey_in(cstring) RETURNS uintgistkey
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uintgistkey_out(uintgistkey) RETURNS cstring
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE TYPE uintgistkey (
+    INTERNALLENGTH = 16,
+    INPUT = uintgistkey_in,
+    OUTPUT = uintgistkey_out,
+    ALIGNMENT = double
+);
+
+-- distance operators
+
+CREATE FUNCTION uint2_dist(uint2, uint2) RETURNS uint2
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint4_dist(uint4, uint4) RETURNS uint4
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint8_dist(uint8, uint8) RETURNS uint8
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint2int8_dist(uint2, int8) RETURNS uint8
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint4int8_dist(uint4, int8) RETURNS uint8
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint8int8_dist(uint8, int8) RETURNS uint8
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE OPERATOR <-> (
+    leftarg = uint2,
+    rightarg = uint2,
+    procedure = uint2_dist,
+    commutator = <->
+);
+
+CREATE OPERATOR <-> (
+    leftarg = uint4,
+    rightarg = uint4,
+    procedure = uint4_dist,
+    commutator = <->
+);
+
+CREATE OPERATOR <-> (
+    leftarg = uint8,
+    rightarg = uint8,
+    procedure = uint8_dist,
+    commutator = <->
+);
+
+CREATE OPERATOR <-> (
+    leftarg = uint2,
+    rightarg = int8,
+    procedure = uint2int8_dist
+);
+
+CREATE OPERATOR <-> (
+    leftarg = uint4,
+    rightarg = int8,
+    procedure = uint4int8_dist
+);
+
+CREATE OPERATOR <-> (
+    leftarg = uint8,
+    rightarg = int8,
+    procedure = uint8int8_dist
+);
+
+-- support functions
+
+CREATE FUNCTION uint2_gist_consistent(internal, uint2, smallint, oid, internal) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint2_gist_distance(internal, uint2, smallint, oid, internal) RETURNS float8
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint2_gist_compress(internal) RETURNS internal
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint2_gist_fetch(internal) RETURNS internal
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint4_gist_consistent(internal, uint4, smallint, oid, internal) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint4_gist_distance(internal, uint4, smallint, oid, internal) RETURNS float8
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint4_gist_compress(internal) RETURNS internal
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint4_gist_fetch(internal) RETURNS internal
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint8_gist_consistent(internal, uint8, smallint, oid, internal) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint8_gist_distance(internal, uint8, smallint, oid, internal) RETURNS float8
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint8_gist_compress(internal) RETURNS internal
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint8_gist_fetch(internal) RETURNS internal
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint_gist_union(internal, internal) RETURNS uintgistkey
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint_gist_penalty(internal, internal, internal) RETURNS internal
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint_gist_picksplit(internal, internal) RETURNS internal
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint_gist_same(uintgistkey, uintgistkey, internal) RETURNS internal
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE OPERATOR CLASS uint2_gist_ops
+    DEFAULT FOR TYPE uint2 USING gist AS
+        OPERATOR        1       < ,
+        OPERATOR        2       <= ,
+        OPERATOR        3       = ,
+        OPERATOR        4       >= ,
+        OPERATOR        5       > ,
+        OPERATOR        6       <> ,
+        OPERATOR        15      <-> FOR ORDER BY uint2_ops_btree,
+        FUNCTION        1       uint2_gist_consistent(internal, uint2, smallint, oid, internal),
+        FUNCTION        2       uint_gist_union(internal, internal),
+        FUNCTION        3       uint2_gist_compress(internal),
+        FUNCTION        5       uint_gist_penalty(internal, internal, internal),
+        FUNCTION        6       uint_gist_picksplit(internal, internal),
+        FUNCTION        7       uint_gist_same(uintgistkey, uintgistkey, internal),
+        FUNCTION        8       uint2_gist_distance(internal, uint2, smallint, oid, internal),
+        FUNCTION        9       uint2_gist_fetch(internal),
+        STORAGE         uintgistkey;
+
+CREATE OPERATOR CLASS uint4_gist_ops
+    DEFAULT FOR TYPE uint4 USING gist AS
+        OPERATOR        1       < ,
+        OPERATOR        2       <= ,
+        OPERATOR        3       = ,
+        OPERATOR        4       >= ,
+        OPERATOR        5       > ,
+        OPERATOR        6       <> ,
+        OPERATOR        15      <-> FOR ORDER BY uint4_ops_btree,
+        FUNCTION        1       uint4_gist_consistent(internal, uint4, smallint, oid, internal),
+        FUNCTION        2       uint_gist_union(internal, internal),
+        FUNCTION        3       uint4_gist_compress(internal),
+        FUNCTION        5       uint_gist_penalty(internal, internal, internal),
+        FUNCTION        6       uint_gist_picksplit(internal, internal),
+        FUNCTION        7       uint_gist_same(uintgistkey, uintgistkey, internal),
+        FUNCTION        8       uint4_gist_distance(internal, uint4, smallint, oid, internal),
+        FUNCTION        9       uint4_gist_fetch(internal),
+        STORAGE         uintgistkey;
+
+CREATE OPERATOR CLASS uint8_gist_ops
+    DEFAULT FOR TYPE uint8 USING gist AS
+        OPERATOR        1       < ,
+        OPERATOR        2       <= ,
+        OPERATOR        3       = ,
+        OPERATOR        4       >= ,
+        OPERATOR        5       > ,
+        OPERATOR        6       <> ,
+        OPERATOR        15      <-> FOR ORDER BY uint8_ops_btree,
+        FUNCTION        1       uint8_gist_consistent(internal, uint8, smallint, oid, internal),
+        FUNCTION        2       uint_gist_union(internal, internal),
+        FUNCTION        3       uint8_gist_compress(internal),
+        FUNCTION        5       uint_gist_penalty(internal, internal, internal),
+        FUNCTION        6       uint_gist_picksplit(internal, internal),
+        FUNCTION        7       uint_gist_same(uintgistkey, uintgistkey, internal),
+        FUNCTION        8       uint8_gist_distance(internal, uint8, smallint, oid, internal),
+        FUNCTION        9       uint8_gist_fetch(internal),
+        STORAGE         uintgistkey;
+
+-- Comparisons with signed values, so that "col = 5" and "col <-> 5" can use
+-- the index; the support functions tell the types apart by subtype.
+
+ALTER OPERATOR FAMILY uint2_gist_ops USING gist ADD
+        OPERATOR        1       < (uint2, int2),
+        OPERATOR        2       <= (uint2, int2),
+        OPERATOR        3       = (uint2, int2),
+        OPERATOR        4       >= (uint2, int2),
+        OPERATOR        5       > (uint2, int2),
+        OPERATOR        6       <> (uint2, int2),
+        OPERATOR        1       < (uint2, int4),
+        OPERATOR        2       <= (uint2, int4),
+        OPERATOR        3       = (uint2, int4),
+        OPERATOR        4       >= (uint2, int4),
+        OPERATOR        5       > (uint2, int4),
+        OPERATOR        6       <> (uint2, int4),
+        OPERATOR        1       < (uint2, int8),
+        OPERATOR        2       <= (uint2, int8),
+        OPERATOR        3       = (uint2, int8),
+        OPERATOR        4       >= (uint2, int8),
+        OPERATOR        5       > (uint2, int8),
+        OPERATOR        6       <> (uint2, int8),
+        OPERATOR        15      <-> (uint2, int8) FOR ORDER BY uint8_ops_btree;
+
+ALTER OPERATOR FAMILY uint4_gist_ops USING gist ADD
+        OPERATOR        1       < (uint4, int2),
+        OPERATOR        2       <= (uint4, int2),
+        OPERATOR        3       = (uint4, int2),
+        OPERATOR        4       >= (uint4, int2),
+        OPERATOR        5       > (uint4, int2),
+        OPERATOR        6       <> (uint4, int2),
+        OPERATOR        1       < (uint4, int4),
+        OPERATOR        2       <= (uint4, int4),
+        OPERATOR        3       = (uint4, int4),
+        OPERATOR        4       >= (uint4, int4),
+        OPERATOR        5       > (uint4, int4),
+        OPERATOR        6       <> (uint4, int4),
+        OPERATOR        1       < (uint4, int8),
+        OPERATOR        2       <= (uint4, int8),
+        OPERATOR        3       = (uint4, int8),
+        OPERATOR        4       >= (uint4, int8),
+        OPERATOR        5       > (uint4, int8),
+        OPERATOR        6       <> (uint4, int8),
+        OPERATOR        15      <-> (uint4, int8) FOR ORDER BY uint8_ops_btree;
+
+ALTER OPERATOR FAMILY uint8_gist_ops USING gist ADD
+        OPERATOR        1       < (uint8, int2),
+        OPERATOR        2       <= (uint8, int2),
+        OPERATOR        3       = (uint8, int2),
+        OPERATOR        4       >= (uint8, int2),
+        OPERATOR        5       > (uint8, int2),
+        OPERATOR        6       <> (uint8, int2),
+        OPERATOR        1       < (uint8, int4),
+        OPERATOR        2       <= (uint8, int4),
+        OPERATOR        3       = (uint8, int4),
+        OPERATOR        4       >= (uint8, int4),
+        OPERATOR        5       > (uint8, int4),
+        OPERATOR        6       <> (uint8, int4),
+        OPERATOR        1       < (uint8, int8),
+        OPERATOR        2       <= (uint8, int8),
+        OPERATOR        3       = (uint8, int8),
+        OPERATOR        4       >= (uint8, int8),
+        OPERATOR        5       > (uint8, int8),
+        OPERATOR        6       <> (uint8, int8),
+        OPERATOR        15      <-> (uint8, int8) FOR ORDER BY uint8_ops_btree;
+
+
+-- Range types
+--
+-- Discrete ranges, canonicalized to [lower, upper).  The core range_ops
+-- operator classes index them with GiST and SP-GiST.  PostgreSQL also
+-- creates the matching uint4multirange and uint8multirange types.
+
+CREATE TYPE uint4range;
+
+CREATE FUNCTION uint4range_canonical(uint4range) RETURNS uint4range
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint4range_subdiff(uint4, uint4) RETURNS float8
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE TYPE uint4range AS RANGE (
+    SUBTYPE = uint4,
+    SUBTYPE_DIFF = uint4range_subdiff,
+    CANONICAL = uint4range_canonical
+);
+
+CREATE TYPE uint8range;
+
+CREATE FUNCTION uint8range_canonical(uint8range) RETURNS uint8range
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint8range_subdiff(uint8, uint8) RETURNS float8
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE TYPE uint8range AS RANGE (
+    SUBTYPE = uint8,
+    SUBTYPE_DIFF = uint8range_subdiff,
+    CANONICAL = uint8range_canonical
+);
+
+
+-- Array functions
+--
+-- GIN indexes on uint4[] and uint8[] need no operator class of their own:
+-- the core array_ops class handles any element type with a default btree
+-- operator class.  These are the contrib/intarray helpers for the unsigned
+-- element types.
+
+CREATE FUNCTION icount(uint4[]) RETURNS integer
+AS 'MODULE_PATHNAME', 'uint4_array_icount'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION sort(uint4[]) RETURNS uint4[]
+AS 'MODULE_PATHNAME', 'uint4_array_sort'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION sort(uint4[], text) RETURNS uint4[]
+AS 'MODULE_PATHNAME', 'uint4_array_sort_dir'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION sort_asc(uint4[]) RETURNS uint4[]
+AS 'MODULE_PATHNAME', 'uint4_array_sort'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION sort_desc(uint4[]) RETURNS uint4[]
+AS 'MODULE_PATHNAME', 'uint4_array_sort_desc'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uniq(uint4[]) RETURNS uint4[]
+AS 'MODULE_PATHNAME', 'uint4_array_uniq'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION idx(uint4[], uint4) RETURNS integer
+AS 'MODULE_PATHNAME', 'uint4_array_idx'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint4_array_inter(uint4[], uint4[]) RETURNS uint4[]
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint4_array_union(uint4[], uint4[]) RETURNS uint4[]
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE OPERATOR # (
+    rightarg = uint4[],
+    procedure = icount
+);
+
+CREATE OPERATOR # (
+    leftarg = uint4[],
+    rightarg = uint4,
+    procedure = idx
+);
+
+CREATE OPERATOR & (
+    leftarg = uint4[],
+    rightarg = uint4[],
+    procedure = uint4_array_inter,
+    commutator = &
+);
+
+CREATE OPERATOR | (
+    leftarg = uint4[],
+    rightarg = uint4[],
+    procedure = uint4_array_union,
+    commutator = |
+);
+
+CREATE FUNCTION icount(uint8[]) RETURNS integer
+AS 'MODULE_PATHNAME', 'uint8_array_icount'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION sort(uint8[]) RETURNS uint8[]
+AS 'MODULE_PATHNAME', 'uint8_array_sort'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION sort(uint8[], text) RETURNS uint8[]
+AS 'MODULE_PATHNAME', 'uint8_array_sort_dir'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION sort_asc(uint8[]) RETURNS uint8[]
+AS 'MODULE_PATHNAME', 'uint8_array_sort'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION sort_desc(uint8[]) RETURNS uint8[]
+AS 'MODULE_PATHNAME', 'uint8_array_sort_desc'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uniq(uint8[]) RETURNS uint8[]
+AS 'MODULE_PATHNAME', 'uint8_array_uniq'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION idx(uint8[], uint8) RETURNS integer
+AS 'MODULE_PATHNAME', 'uint8_array_idx'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint8_array_inter(uint8[], uint8[]) RETURNS uint8[]
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint8_array_union(uint8[], uint8[]) RETURNS uint8[]
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE OPERATOR # (
+    rightarg = uint8[],
+    procedure = icount
+);
+
+CREATE OPERATOR # (
+    leftarg = uint8[],
+    rightarg = uint8,
+    procedure = idx
+);
+
+CREATE OPERATOR & (
+    leftarg = uint8[],
+    rightarg = uint8[],
+    procedure = uint8_array_inter,
+    commutator = &
+);
+
+CREATE OPERATOR | (
+    leftarg = uint8[],
+    rightarg = uint8[],
+    procedure = uint8_array_union,
+    commutator = |
+);
+
+
+-- Compressed sets
+--
+-- uint4set stores sorted, distinct uint4 values in blocks of bit-packed
+-- gaps.  It is meant for large ID lists, which it keeps at a few bits per
+-- value; "@>" and "&" only unpack the blocks they need.
+
+CREATE TYPE uint4set;
+
+CREATE FUNCTION uint4set_in(cstring) RETURNS uint4set
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint4set_out(uint4set) RETURNS cstring
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE TYPE uint4set (
+    INTERNALLENGTH = variable,
+    INPUT = uint4set_in,
+    OUTPUT = uint4set_out,
+    ALIGNMENT = int4,
+    STORAGE = extended
+);
+
+CREATE FUNCTION uint4set(uint4[]) RETURNS uint4set
+AS 'MODULE_PATHNAME', 'uint4set_from_array'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint4set_to_array(uint4set) RETURNS uint4[]
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE CAST (uint4[] AS uint4set) WITH FUNCTION uint4set(uint4[]);
+CREATE CAST (uint4set AS uint4[]) WITH FUNCTION uint4set_to_array(uint4set);
+
+CREATE FUNCTION uint4set_count(uint4set) RETURNS bigint
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint4set_contains(uint4set, uint4) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint4set_contained(uint4, uint4set) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint4set_intersect(uint4set, uint4set) RETURNS uint4set
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint4set_union(uint4set, uint4set) RETURNS uint4set
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE OPERATOR # (
+    rightarg = uint4set,
+    procedure = uint4set_count
+);
+
+CREATE OPERATOR @> (
+    leftarg = uint4set,
+    rightarg = uint4,
+    procedure = uint4set_contains,
+    commutator = <@,
+    restrict = contsel,
+    join = contjoinsel
+);
+
+CREATE OPERATOR <@ (
+    leftarg = uint4,
+    rightarg = uint4set,
+    procedure = uint4set_contained,
+    commutator = @>,
+    restrict = contsel,
+    join = contjoinsel
+);
+
+CREATE OPERATOR & (
+    leftarg = uint4set,
+    rightarg = uint4set,
+    procedure = uint4set_intersect,
+    commutator = &
+);
+
+CREATE OPERATOR | (
+    leftarg = uint4set,
+    rightarg = uint4set,
+    procedure = uint4set_union,
+    commutator = |
+);
+
+
+-- Roaring bitmaps
+--
+-- uint4bitmap holds a set of uint4 values as Roaring containers.
+-- uint4bitmap_agg builds one from values and uint4bitmap_or_agg unions
+-- stored bitmaps; both run in parallel.  "&", "|", "#" and "-" are
+-- intersection, union, symmetric difference and difference.
+
+CREATE TYPE uint4bitmap;
+
+CREATE FUNCTION uint4bitmap_in(cstring) RETURNS uint4bitmap
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint4bitmap_out(uint4bitmap) RETURNS cstring
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE TYPE uint4bitmap (
+    INTERNALLENGTH = variable,
+    INPUT = uint4bitmap_in,
+    OUTPUT = uint4bitmap_out,
+    ALIGNMENT = double,
+    STORAGE = extended
+);
+
+CREATE FUNCTION uint4bitmap_cardinality(uint4bitmap) RETURNS bigint
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint4bitmap_contains(uint4bitmap, uint4) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint4bitmap_contained(uint4, uint4bitmap) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint4bitmap_and(uint4bitmap, uint4bitmap) RETURNS uint4bitmap
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint4bitmap_or(uint4bitmap, uint4bitmap) RETURNS uint4bitmap
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint4bitmap_xor(uint4bitmap, uint4bitmap) RETURNS uint4bitmap
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint4bitmap_andnot(uint4bitmap, uint4bitmap) RETURNS uint4bitmap
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint4bitmap_values(uint4bitmap) RETURNS SETOF uint4
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE OPERATOR # (
+    rightarg = uint4bitmap,
+    procedure = uint4bitmap_cardinality
+);
+
+CREATE OPERATOR @> (
+    leftarg = uint4bitmap,
+    rightarg = uint4,
+    procedure = uint4bitmap_contains,
+    commutator = <@,
+    restrict = contsel,
+    join = contjoinsel
+);
+
+CREATE OPERATOR <@ (
+    leftarg = uint4,
+    rightarg = uint4bitmap,
+    procedure = uint4bitmap_contained,
+    commutator = @>,
+    restrict = contsel,
+    join = contjoinsel
+);
+
+CREATE OPERATOR & (
+    leftarg = uint4bitmap,
+    rightarg = uint4bitmap,
+    procedure = uint4bitmap_and,
+    commutator = &
+);
+
+CREATE OPERATOR | (
+    leftarg = uint4bitmap,
+    rightarg = uint4bitmap,
+    procedure = uint4bitmap_or,
+    commutator = |
+);
+
+CREATE OPERATOR # (
+    leftarg = uint4bitmap,
+    rightarg = uint4bitmap,
+    procedure = uint4bitmap_xor,
+    commutator = #
+);
+
+CREATE OPERATOR - (
+    leftarg = uint4bitmap,
+    rightarg = uint4bitmap,
+    procedure = uint4bitmap_andnot
+);
+
+CREATE FUNCTION uint4bitmap_agg_trans(internal, uint4) RETURNS internal
+AS 'MODULE_PATHNAME'
+LANGUAGE C IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint4bitmap_or_trans(internal, uint4bitmap) RETURNS internal
+AS 'MODULE_PATHNAME'
+LANGUAGE C IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint4bitmap_agg_combine(internal, internal) RETURNS internal
+AS 'MODULE_PATHNAME'
+LANGUAGE C IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint4bitmap_agg_serialize(internal) RETURNS bytea
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint4bitmap_agg_deserialize(bytea, internal) RETURNS internal
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint4bitmap_agg_final(internal) RETURNS uint4bitmap
+AS 'MODULE_PATHNAME'
+LANGUAGE C IMMUTABLE PARALLEL SAFE;
+
+CREATE AGGREGATE uint4bitmap_agg(uint4) (
+    SFUNC = uint4bitmap_agg_trans,
+    STYPE = internal,
+    FINALFUNC = uint4bitmap_agg_final,
+    COMBINEFUNC = uint4bitmap_agg_combine,
+    SERIALFUNC = uint4bitmap_agg_serialize,
+    DESERIALFUNC = uint4bitmap_agg_deserialize,
+    PARALLEL = SAFE
+);
+
+CREATE AGGREGATE uint4bitmap_or_agg(uint4bitmap) (
+    SFUNC = uint4bitmap_or_trans,
+    STYPE = internal,
+    FINALFUNC = uint4bitmap_agg_final,
+    COMBINEFUNC = uint4bitmap_agg_combine,
+    SERIALFUNC = uint4bitmap_agg_serialize,
+    DESERIALFUNC = uint4bitmap_agg_deserialize,
+    PARALLEL = SAFE
+);
+
+
+-- Series
+--
+-- generate_series over uint4 and uint8, with an int8 step that may be
+-- negative.  The support function estimates the row count.
+
+CREATE FUNCTION generate_series_uint_support(internal) RETURNS internal
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION generate_series(uint4, uint4) RETURNS SETOF uint4
+AS 'MODULE_PATHNAME', 'generate_series_uint4'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE
+SUPPORT generate_series_uint_support;
+
+CREATE FUNCTION generate_series(uint4, uint4, int8) RETURNS SETOF uint4
+AS 'MODULE_PATHNAME', 'generate_series_step_uint4'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE
+SUPPORT generate_series_uint_support;
+
+CREATE FUNCTION generate_series(uint8, uint8) RETURNS SETOF uint8
+AS 'MODULE_PATHNAME', 'generate_series_uint8'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE
+SUPPORT generate_series_uint_support;
+
+CREATE FUNCTION generate_series(uint8, uint8, int8) RETURNS SETOF uint8
+AS 'MODULE_PATHNAME', 'generate_series_step_uint8'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE
+SUPPORT generate_series_uint_support;
+
+
+-- Extended hashing
+--
+-- Hash support function 2 is a seeded 64-bit hash.  Hash partitioning
+-- requires it, and so do hash indexes built in parallel.  As with function
+-- 1, the unsigned hashes agree with the core hashint2/4/8extended on the
+-- values the types share, so the cross-type members use the core ones.
+
+CREATE FUNCTION uint1_hash_extended(uint1, int8) RETURNS int8
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint2_hash_extended(uint2, int8) RETURNS int8
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint4_hash_extended(uint4, int8) RETURNS int8
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint8_hash_extended(uint8, int8) RETURNS int8
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+ALTER OPERATOR FAMILY uint1_ops_hash USING hash ADD
+        FUNCTION        2       (uint1) uint1_hash_extended(uint1, int8);
+
+ALTER OPERATOR FAMILY uint2_ops_hash USING hash ADD
+        FUNCTION        2       (uint2) uint2_hash_extended(uint2, int8),
+        FUNCTION        2       (uint4) uint4_hash_extended(uint4, int8),
+        FUNCTION        2       (uint8) uint8_hash_extended(uint8, int8),
+        FUNCTION        2       (int2) hashint2extended(int2, int8),
+        FUNCTION        2       (int4) hashint4extended(int4, int8),
+        FUNCTION        2       (int8) hashint8extended(int8, int8);
+
+ALTER OPERATOR FAMILY uint4_ops_hash USING hash ADD
+        FUNCTION        2       (uint4) uint4_hash_extended(uint4, int8),
+        FUNCTION        2       (uint2) uint2_hash_extended(uint2, int8),
+        FUNCTION        2       (uint8) uint8_hash_extended(uint8, int8),
+        FUNCTION        2       (int2) hashint2extended(int2, int8),
+        FUNCTION        2       (int4) hashint4extended(int4, int8),
+        FUNCTION        2       (int8) hashint8extended(int8, int8);
+
+ALTER OPERATOR FAMILY uint8_ops_hash USING hash ADD
+        FUNCTION        2       (uint8) uint8_hash_extended(uint8, int8),
+        FUNCTION        2       (uint2) uint2_hash_extended(uint2, int8),
+        FUNCTION        2       (uint4) uint4_hash_extended(uint4, int8),
+        FUNCTION        2       (int2) hashint2extended(int2, int8),
+        FUNCTION        2       (int4) hashint4extended(int4, int8),
+        FUNCTION        2       (int8) hashint8extended(int8, int8);
+
+
+-- Window RANGE frames
+--
+-- in_range is btree support function 3.  Each uint column type gets one
+-- per unsigned offset width and one taking int8, so that an integer literal
+-- such as "RANGE BETWEEN 1000 PRECEDING" has a single match.
+
+CREATE FUNCTION in_range(uint2, uint2, uint2, bool, bool) RETURNS bool
+AS 'MODULE_PATHNAME', 'in_range_uint2_uint2'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION in_range(uint2, uint2, uint4, bool, bool) RETURNS bool
+AS 'MODULE_PATHNAME', 'in_range_uint2_uint4'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION in_range(uint2, uint2, uint8, bool, bool) RETURNS bool
+AS 'MODULE_PATHNAME', 'in_range_uint2_uint8'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION in_range(uint2, uint2, int8, bool, bool) RETURNS bool
+AS 'MODULE_PATHNAME', 'in_range_uint2_int8'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION in_range(uint4, uint4, uint2, bool, bool) RETURNS bool
+AS 'MODULE_PATHNAME', 'in_range_uint4_uint2'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION in_range(uint4, uint4, uint4, bool, bool) RETURNS bool
+AS 'MODULE_PATHNAME', 'in_range_uint4_uint4'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION in_range(uint4, uint4, uint8, bool, bool) RETURNS bool
+AS 'MODULE_PATHNAME', 'in_range_uint4_uint8'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION in_range(uint4, uint4, int8, bool, bool) RETURNS bool
+AS 'MODULE_PATHNAME', 'in_range_uint4_int8'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION in_range(uint8, uint8, uint2, bool, bool) RETURNS bool
+AS 'MODULE_PATHNAME', 'in_range_uint8_uint2'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION in_range(uint8, uint8, uint4, bool, bool) RETURNS bool
+AS 'MODULE_PATHNAME', 'in_range_uint8_uint4'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION in_range(uint8, uint8, uint8, bool, bool) RETURNS bool
+AS 'MODULE_PATHNAME', 'in_range_uint8_uint8'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION in_range(uint8, uint8, int8, bool, bool) RETURNS bool
+AS 'MODULE_PATHNAME', 'in_range_uint8_int8'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+ALTER OPERATOR FAMILY uint2_ops_btree USING btree ADD
+        FUNCTION        3       (uint2, uint2) in_range(uint2, uint2, uint2, bool, bool),
+        FUNCTION        3       (uint2, uint4) in_range(uint2, uint2, uint4, bool, bool),
+        FUNCTION        3       (uint2, uint8) in_range(uint2, uint2, uint8, bool, bool),
+        FUNCTION        3       (uint2, int8) in_range(uint2, uint2, int8, bool, bool);
+
+ALTER OPERATOR FAMILY uint4_ops_btree USING btree ADD
+        FUNCTION        3       (uint4, uint2) in_range(uint4, uint4, uint2, bool, bool),
+        FUNCTION        3       (uint4, uint4) in_range(uint4, uint4, uint4, bool, bool),
+        FUNCTION        3       (uint4, uint8) in_range(uint4, uint4, uint8, bool, bool),
+        FUNCTION        3       (uint4, int8) in_range(uint4, uint4, int8, bool, bool);
+
+ALTER OPERATOR FAMILY uint8_ops_btree USING btree ADD
+        FUNCTION        3       (uint8, uint2) in_range(uint8, uint8, uint2, bool, bool),
+        FUNCTION        3       (uint8, uint4) in_range(uint8, uint8, uint4, bool, bool),
+        FUNCTION        3       (uint8, uint8) in_range(uint8, uint8, uint8, bool, bool),
+        FUNCTION        3       (uint8, int8) in_range(uint8, uint8, int8, bool, bool);
+
+
+-- Btree deduplication
+--
+-- Btree support function 4 says whether equal values are always
+-- bitwise-equal, which is what lets an index deduplicate them into posting
+-- lists.  That holds for every uint type, so the core btequalimage serves.
+-- The flag is recorded when an index is built: indexes created before this
+-- upgrade need a REINDEX to start deduplicating.
+
+ALTER OPERATOR FAMILY uint1_ops_btree USING btree ADD
+        FUNCTION        4       (uint1, uint1) btequalimage(oid);
+
+ALTER OPERATOR FAMILY uint2_ops_btree USING btree ADD
+        FUNCTION        4       (uint2, uint2) btequalimage(oid);
+
+ALTER OPERATOR FAMILY uint4_ops_btree USING btree ADD
+        FUNCTION        4       (uint4, uint4) btequalimage(oid);
+
+ALTER OPERATOR FAMILY uint8_ops_btree USING btree ADD
+        FUNCTION        4       (uint8, uint8) btequalimage(oid);
+
+
+-- UINT V definition
+--
+-- uintv stores the values of uint8 in as few bytes as they need: one byte
+-- of header plus zero to eight of value, see uintv.h.  It converts to uint8
+-- implicitly, so arithmetic and most aggregates go through uint8; uint4 and
+-- uint8 convert to it on assignment.  Implicit casts both ways would make
+-- mixed comparisons ambiguous.
+CREATE TYPE uintv;
+
+CREATE FUNCTION uintvin(cstring) RETURNS uintv
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uintvout(uintv) RETURNS cstring
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uintvrecv(internal) RETURNS uintv
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uintvsend(uintv) RETURNS bytea
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE TYPE uintv (
+    INTERNALLENGTH = VARIABLE,
+    INPUT = uintvin,
+    OUTPUT = uintvout,
+    RECEIVE = uintvrecv,
+    SEND = uintvsend,
+    STORAGE = main,
+    ALIGNMENT = int4
+);
+
+-- conversion functions
+
+CREATE FUNCTION uvtou8(uintv) RETURNS uint8
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION u8touv(uint8) RETURNS uintv
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uvtou4(uintv) RETURNS uint4
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION u4touv(uint4) RETURNS uintv
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+-- comparison functions
+
+CREATE FUNCTION uintveq(uintv, uintv) RETURNS BOOLEAN
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uintvne(uintv, uintv) RETURNS BOOLEAN
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uintvlt(uintv, uintv) RETURNS BOOLEAN
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uintvle(uintv, uintv) RETURNS BOOLEAN
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uintvgt(uintv, uintv) RETURNS BOOLEAN
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uintvge(uintv, uintv) RETURNS BOOLEAN
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+
+-- UINT V operators
+
+CREATE CAST (uintv AS uint8) WITH FUNCTION uvtou8(uintv) AS IMPLICIT;
+CREATE CAST (uint8 AS uintv) WITH FUNCTION u8touv(uint8) AS ASSIGNMENT;
+CREATE CAST (uintv AS uint4) WITH FUNCTION uvtou4(uintv) AS ASSIGNMENT;
+CREATE CAST (uint4 AS uintv) WITH FUNCTION u4touv(uint4) AS ASSIGNMENT;
+
+CREATE OPERATOR > (
+    rightarg = uintv,
+    leftarg = uintv,
+    procedure = uintvgt,
+    commutator = <,
+    negator = <=,
+    restrict = uint_scalargtsel,
+    join = scalargtjoinsel
+);
+
+CREATE OPERATOR < (
+    rightarg = uintv,
+    leftarg = uintv,
+    procedure = uintvlt,
+    commutator = >,
+    negator = >=,
+    restrict = uint_scalarltsel,
+    join = scalarltjoinsel
+);
+
+CREATE OPERATOR <= (
+    rightarg = uintv,
+    leftarg = uintv,
+    procedure = uintvle,
+    commutator = >=,
+    negator = >,
+    restrict = uint_scalarlesel,
+    join = scalarlejoinsel
+);
+
+CREATE OPERATOR >= (
+    rightarg = uintv,
+    leftarg = uintv,
+    procedure = uintvge,
+    commutator = <=,
+    negator = <,
+    restrict = uint_scalargesel,
+    join = scalargejoinsel
+);
+
+CREATE OPERATOR = (
+    rightarg = uintv,
+    leftarg = uintv,
+    procedure = uintveq,
+    commutator = =,
+    negator = <>,
+    restrict = eqsel,
+    join = eqjoinsel,
+    hashes,
+    merges
+);
+
+CREATE OPERATOR <> (
+    rightarg = uintv,
+    leftarg = uintv,
+    procedure = uintvne,
+    commutator = <>,
+    negator = =,
+    restrict = neqsel,
+    join = neqjoinsel
+);
+
+-- UINT V operator classes
+
+CREATE FUNCTION uintv_cmp(uintv, uintv) RETURNS INTEGER
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uintv_sortsupport(internal) RETURNS void
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uintv_hash(uintv) RETURNS INTEGER
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uintv_hash_extended(uintv, int8) RETURNS int8
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE OPERATOR CLASS uintv_ops_btree
+    DEFAULT FOR TYPE uintv USING btree AS
+        OPERATOR        1       < ,
+        OPERATOR        2       <= ,
+        OPERATOR        3       = ,
+        OPERATOR        4       >= ,
+        OPERATOR        5       > ,
+        FUNCTION        1       uintv_cmp(uintv, uintv),
+        FUNCTION        2       uintv_sortsupport(internal),
+        FUNCTION        4       btequalimage(oid);
+
+CREATE OPERATOR CLASS uintv_ops_hash
+    DEFAULT FOR TYPE uintv USING hash AS
+        OPERATOR        1       = ,
+        FUNCTION        1       uintv_hash(uintv),
+        FUNCTION        2       uintv_hash_extended(uintv, int8);
+
+
+-- UINT V cross-type operators
+--
+-- uintv compares directly with each fixed-width integer type, so that an
+-- index on a uintv column serves "v = 42" and a uintv column can be joined
+-- to a uint8 one.  The hashes agree with uint8_hash and hashint8 for equal
+-- values, as they do within the uint8 family.
+
+CREATE FUNCTION uintvuint2eq(uintv, uint2) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uintvuint2ne(uintv, uint2) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uintvuint2lt(uintv, uint2) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uintvuint2le(uintv, uint2) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uintvuint2gt(uintv, uint2) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uintvuint2ge(uintv, uint2) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uintvuint2_cmp(uintv, uint2) RETURNS INTEGER
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE OPERATOR > (
+    rightarg = uint2,
+    leftarg = uintv,
+    procedure = uintvuint2gt,
+    commutator = <,
+    negator = <=,
+    restrict = uint_scalargtsel,
+    join = scalargtjoinsel
+);
+
+CREATE OPERATOR < (
+    rightarg = uint2,
+    leftarg = uintv,
+    procedure = uintvuint2lt,
+    commutator = >,
+    negator = >=,
+    restrict = uint_scalarltsel,
+    join = scalarltjoinsel
+);
+
+CREATE OPERATOR <= (
+    rightarg = uint2,
+    leftarg = uintv,
+    procedure = uintvuint2le,
+    commutator = >=,
+    negator = >,
+    restrict = uint_scalarlesel,
+    join = scalarlejoinsel
+);
+
+CREATE OPERATOR >= (
+    rightarg = uint2,
+    leftarg = uintv,
+    procedure = uintvuint2ge,
+    commutator = <=,
+    negator = <,
+    restrict = uint_scalargesel,
+    join = scalargejoinsel
+);
+
+CREATE OPERATOR = (
+    rightarg = uint2,
+    leftarg = uintv,
+    procedure = uintvuint2eq,
+    commutator = =,
+    negator = <>,
+    restrict = eqsel,
+    join = eqjoinsel,
+    hashes,
+    merges
+);
+
+CREATE OPERATOR <> (
+    rightarg = uint2,
+    leftarg = uintv,
+    procedure = uintvuint2ne,
+    commutator = <>,
+    negator = =,
+    restrict = neqsel,
+    join = neqjoinsel
+);
+
+CREATE FUNCTION uint2uintveq(uint2, uintv) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint2uintvne(uint2, uintv) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint2uintvlt(uint2, uintv) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint2uintvle(uint2, uintv) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint2uintvgt(uint2, uintv) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint2uintvge(uint2, uintv) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint2uintv_cmp(uint2, uintv) RETURNS INTEGER
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE OPERATOR > (
+    rightarg = uintv,
+    leftarg = uint2,
+    procedure = uint2uintvgt,
+    commutator = <,
+    negator = <=,
+    restrict = uint_scalargtsel,
+    join = scalargtjoinsel
+);
+
+CREATE OPERATOR < (
+    rightarg = uintv,
+    leftarg = uint2,
+    procedure = uint2uintvlt,
+    commutator = >,
+    negator = >=,
+    restrict = uint_scalarltsel,
+    join = scalarltjoinsel
+);
+
+CREATE OPERATOR <= (
+    rightarg = uintv,
+    leftarg = uint2,
+    procedure = uint2uintvle,
+    commutator = >=,
+    negator = >,
+    restrict = uint_scalarlesel,
+    join = scalarlejoinsel
+);
+
+CREATE OPERATOR >= (
+    rightarg = uintv,
+    leftarg = uint2,
+    procedure = uint2uintvge,
+    commutator = <=,
+    negator = <,
+    restrict = uint_scalargesel,
+    join = scalargejoinsel
+);
+
+CREATE OPERATOR = (
+    rightarg = uintv,
+    leftarg = uint2,
+    procedure = uint2uintveq,
+    commutator = =,
+    negator = <>,
+    restrict = eqsel,
+    join = eqjoinsel,
+    hashes,
+    merges
+);
+
+CREATE OPERATOR <> (
+    rightarg = uintv,
+    leftarg = uint2,
+    procedure = uint2uintvne,
+    commutator = <>,
+    negator = =,
+    restrict = neqsel,
+    join = neqjoinsel
+);
+
+CREATE FUNCTION uintvuint4eq(uintv, uint4) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uintvuint4ne(uintv, uint4) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uintvuint4lt(uintv, uint4) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uintvuint4le(uintv, uint4) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uintvuint4gt(uintv, uint4) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uintvuint4ge(uintv, uint4) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uintvuint4_cmp(uintv, uint4) RETURNS INTEGER
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE OPERATOR > (
+    rightarg = uint4,
+    leftarg = uintv,
+    procedure = uintvuint4gt,
+    commutator = <,
+    negator = <=,
+    restrict = uint_scalargtsel,
+    join = scalargtjoinsel
+);
+
+CREATE OPERATOR < (
+    rightarg = uint4,
+    leftarg = uintv,
+    procedure = uintvuint4lt,
+    commutator = >,
+    negator = >=,
+    restrict = uint_scalarltsel,
+    join = scalarltjoinsel
+);
+
+CREATE OPERATOR <= (
+    rightarg = uint4,
+    leftarg = uintv,
+    procedure = uintvuint4le,
+    commutator = >=,
+    negator = >,
+    restrict = uint_scalarlesel,
+    join = scalarlejoinsel
+);
+
+CREATE OPERATOR >= (
+    rightarg = uint4,
+    leftarg = uintv,
+    procedure = uintvuint4ge,
+    commutator = <=,
+    negator = <,
+    restrict = uint_scalargesel,
+    join = scalargejoinsel
+);
+
+CREATE OPERATOR = (
+    rightarg = uint4,
+    leftarg = uintv,
+    procedure = uintvuint4eq,
+    commutator = =,
+    negator = <>,
+    restrict = eqsel,
+    join = eqjoinsel,
+    hashes,
+    merges
+);
+
+CREATE OPERATOR <> (
+    rightarg = uint4,
+    leftarg = uintv,
+    procedure = uintvuint4ne,
+    commutator = <>,
+    negator = =,
+    restrict = neqsel,
+    join = neqjoinsel
+);
+
+CREATE FUNCTION uint4uintveq(uint4, uintv) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint4uintvne(uint4, uintv) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint4uintvlt(uint4, uintv) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint4uintvle(uint4, uintv) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint4uintvgt(uint4, uintv) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint4uintvge(uint4, uintv) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint4uintv_cmp(uint4, uintv) RETURNS INTEGER
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE OPERATOR > (
+    rightarg = uintv,
+    leftarg = uint4,
+    procedure = uint4uintvgt,
+    commutator = <,
+    negator = <=,
+    restrict = uint_scalargtsel,
+    join = scalargtjoinsel
+);
+
+CREATE OPERATOR < (
+    rightarg = uintv,
+    leftarg = uint4,
+    procedure = uint4uintvlt,
+    commutator = >,
+    negator = >=,
+    restrict = uint_scalarltsel,
+    join = scalarltjoinsel
+);
+
+CREATE OPERATOR <= (
+    rightarg = uintv,
+    leftarg = uint4,
+    procedure = uint4uintvle,
+    commutator = >=,
+    negator = >,
+    restrict = uint_scalarlesel,
+    join = scalarlejoinsel
+);
+
+CREATE OPERATOR >= (
+    rightarg = uintv,
+    leftarg = uint4,
+    procedure = uint4uintvge,
+    commutator = <=,
+    negator = <,
+    restrict = uint_scalargesel,
+    join = scalargejoinsel
+);
+
+CREATE OPERATOR = (
+    rightarg = uintv,
+    leftarg = uint4,
+    procedure = uint4uintveq,
+    commutator = =,
+    negator = <>,
+    restrict = eqsel,
+    join = eqjoinsel,
+    hashes,
+    merges
+);
+
+CREATE OPERATOR <> (
+    rightarg = uintv,
+    leftarg = uint4,
+    procedure = uint4uintvne,
+    commutator = <>,
+    negator = =,
+    restrict = neqsel,
+    join = neqjoinsel
+);
+
+CREATE FUNCTION uintvuint8eq(uintv, uint8) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uintvuint8ne(uintv, uint8) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uintvuint8lt(uintv, uint8) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uintvuint8le(uintv, uint8) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uintvuint8gt(uintv, uint8) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uintvuint8ge(uintv, uint8) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uintvuint8_cmp(uintv, uint8) RETURNS INTEGER
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE OPERATOR > (
+    rightarg = uint8,
+    leftarg = uintv,
+    procedure = uintvuint8gt,
+    commutator = <,
+    negator = <=,
+    restrict = uint_scalargtsel,
+    join = scalargtjoinsel
+);
+
+CREATE OPERATOR < (
+    rightarg = uint8,
+    leftarg = uintv,
+    procedure = uintvuint8lt,
+    commutator = >,
+    negator = >=,
+    restrict = uint_scalarltsel,
+    join = scalarltjoinsel
+);
+
+CREATE OPERATOR <= (
+    rightarg = uint8,
+    leftarg = uintv,
+    procedure = uintvuint8le,
+    commutator = >=,
+    negator = >,
+    restrict = uint_scalarlesel,
+    join = scalarlejoinsel
+);
+
+CREATE OPERATOR >= (
+    rightarg = uint8,
+    leftarg = uintv,
+    procedure = uintvuint8ge,
+    commutator = <=,
+    negator = <,
+    restrict = uint_scalargesel,
+    join = scalargejoinsel
+);
+
+CREATE OPERATOR = (
+    rightarg = uint8,
+    leftarg = uintv,
+    procedure = uintvuint8eq,
+    commutator = =,
+    negator = <>,
+    restrict = eqsel,
+    join = eqjoinsel,
+    hashes,
+    merges
+);
+
+CREATE OPERATOR <> (
+    rightarg = uint8,
+    leftarg = uintv,
+    procedure = uintvuint8ne,
+    commutator = <>,
+    negator = =,
+    restrict = neqsel,
+    join = neqjoinsel
+);
+
+CREATE FUNCTION uint8uintveq(uint8, uintv) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint8uintvne(uint8, uintv) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint8uintvlt(uint8, uintv) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint8uintvle(uint8, uintv) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint8uintvgt(uint8, uintv) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint8uintvge(uint8, uintv) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uint8uintv_cmp(uint8, uintv) RETURNS INTEGER
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE OPERATOR > (
+    rightarg = uintv,
+    leftarg = uint8,
+    procedure = uint8uintvgt,
+    commutator = <,
+    negator = <=,
+    restrict = uint_scalargtsel,
+    join = scalargtjoinsel
+);
+
+CREATE OPERATOR < (
+    rightarg = uintv,
+    leftarg = uint8,
+    procedure = uint8uintvlt,
+    commutator = >,
+    negator = >=,
+    restrict = uint_scalarltsel,
+    join = scalarltjoinsel
+);
+
+CREATE OPERATOR <= (
+    rightarg = uintv,
+    leftarg = uint8,
+    procedure = uint8uintvle,
+    commutator = >=,
+    negator = >,
+    restrict = uint_scalarlesel,
+    join = scalarlejoinsel
+);
+
+CREATE OPERATOR >= (
+    rightarg = uintv,
+    leftarg = uint8,
+    procedure = uint8uintvge,
+    commutator = <=,
+    negator = <,
+    restrict = uint_scalargesel,
+    join = scalargejoinsel
+);
+
+CREATE OPERATOR = (
+    rightarg = uintv,
+    leftarg = uint8,
+    procedure = uint8uintveq,
+    commutator = =,
+    negator = <>,
+    restrict = eqsel,
+    join = eqjoinsel,
+    hashes,
+    merges
+);
+
+CREATE OPERATOR <> (
+    rightarg = uintv,
+    leftarg = uint8,
+    procedure = uint8uintvne,
+    commutator = <>,
+    negator = =,
+    restrict = neqsel,
+    join = neqjoinsel
+);
+
+CREATE FUNCTION uintvint2eq(uintv, int2) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uintvint2ne(uintv, int2) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uintvint2lt(uintv, int2) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uintvint2le(uintv, int2) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uintvint2gt(uintv, int2) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uintvint2ge(uintv, int2) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uintvint2_cmp(uintv, int2) RETURNS INTEGER
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE OPERATOR > (
+    rightarg = int2,
+    leftarg = uintv,
+    procedure = uintvint2gt,
+    commutator = <,
+    negator = <=,
+    restrict = uint_scalargtsel,
+    join = scalargtjoinsel
+);
+
+CREATE OPERATOR < (
+    rightarg = int2,
+    leftarg = uintv,
+    procedure = uintvint2lt,
+    commutator = >,
+    negator = >=,
+    restrict = uint_scalarltsel,
+    join = scalarltjoinsel
+);
+
+CREATE OPERATOR <= (
+    rightarg = int2,
+    leftarg = uintv,
+    procedure = uintvint2le,
+    commutator = >=,
+    negator = >,
+    restrict = uint_scalarlesel,
+    join = scalarlejoinsel
+);
+
+CREATE OPERATOR >= (
+    rightarg = int2,
+    leftarg = uintv,
+    procedure = uintvint2ge,
+    commutator = <=,
+    negator = <,
+    restrict = uint_scalargesel,
+    join = scalargejoinsel
+);
+
+CREATE OPERATOR = (
+    rightarg = int2,
+    leftarg = uintv,
+    procedure = uintvint2eq,
+    commutator = =,
+    negator = <>,
+    restrict = eqsel,
+    join = eqjoinsel,
+    hashes,
+    merges
+);
+
+CREATE OPERATOR <> (
+    rightarg = int2,
+    leftarg = uintv,
+    procedure = uintvint2ne,
+    commutator = <>,
+    negator = =,
+    restrict = neqsel,
+    join = neqjoinsel
+);
+
+CREATE FUNCTION int2uintveq(int2, uintv) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION int2uintvne(int2, uintv) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION int2uintvlt(int2, uintv) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION int2uintvle(int2, uintv) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION int2uintvgt(int2, uintv) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION int2uintvge(int2, uintv) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION int2uintv_cmp(int2, uintv) RETURNS INTEGER
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE OPERATOR > (
+    rightarg = uintv,
+    leftarg = int2,
+    procedure = int2uintvgt,
+    commutator = <,
+    negator = <=,
+    restrict = uint_scalargtsel,
+    join = scalargtjoinsel
+);
+
+CREATE OPERATOR < (
+    rightarg = uintv,
+    leftarg = int2,
+    procedure = int2uintvlt,
+    commutator = >,
+    negator = >=,
+    restrict = uint_scalarltsel,
+    join = scalarltjoinsel
+);
+
+CREATE OPERATOR <= (
+    rightarg = uintv,
+    leftarg = int2,
+    procedure = int2uintvle,
+    commutator = >=,
+    negator = >,
+    restrict = uint_scalarlesel,
+    join = scalarlejoinsel
+);
+
+CREATE OPERATOR >= (
+    rightarg = uintv,
+    leftarg = int2,
+    procedure = int2uintvge,
+    commutator = <=,
+    negator = <,
+    restrict = uint_scalargesel,
+    join = scalargejoinsel
+);
+
+CREATE OPERATOR = (
+    rightarg = uintv,
+    leftarg = int2,
+    procedure = int2uintveq,
+    commutator = =,
+    negator = <>,
+    restrict = eqsel,
+    join = eqjoinsel,
+    hashes,
+    merges
+);
+
+CREATE OPERATOR <> (
+    rightarg = uintv,
+    leftarg = int2,
+    procedure = int2uintvne,
+    commutator = <>,
+    negator = =,
+    restrict = neqsel,
+    join = neqjoinsel
+);
+
+CREATE FUNCTION uintvint4eq(uintv, int4) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uintvint4ne(uintv, int4) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uintvint4lt(uintv, int4) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uintvint4le(uintv, int4) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uintvint4gt(uintv, int4) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uintvint4ge(uintv, int4) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uintvint4_cmp(uintv, int4) RETURNS INTEGER
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE OPERATOR > (
+    rightarg = int4,
+    leftarg = uintv,
+    procedure = uintvint4gt,
+    commutator = <,
+    negator = <=,
+    restrict = uint_scalargtsel,
+    join = scalargtjoinsel
+);
+
+CREATE OPERATOR < (
+    rightarg = int4,
+    leftarg = uintv,
+    procedure = uintvint4lt,
+    commutator = >,
+    negator = >=,
+    restrict = uint_scalarltsel,
+    join = scalarltjoinsel
+);
+
+CREATE OPERATOR <= (
+    rightarg = int4,
+    leftarg = uintv,
+    procedure = uintvint4le,
+    commutator = >=,
+    negator = >,
+    restrict = uint_scalarlesel,
+    join = scalarlejoinsel
+);
+
+CREATE OPERATOR >= (
+    rightarg = int4,
+    leftarg = uintv,
+    procedure = uintvint4ge,
+    commutator = <=,
+    negator = <,
+    restrict = uint_scalargesel,
+    join = scalargejoinsel
+);
+
+CREATE OPERATOR = (
+    rightarg = int4,
+    leftarg = uintv,
+    procedure = uintvint4eq,
+    commutator = =,
+    negator = <>,
+    restrict = eqsel,
+    join = eqjoinsel,
+    hashes,
+    merges
+);
+
+CREATE OPERATOR <> (
+    rightarg = int4,
+    leftarg = uintv,
+    procedure = uintvint4ne,
+    commutator = <>,
+    negator = =,
+    restrict = neqsel,
+    join = neqjoinsel
+);
+
+CREATE FUNCTION int4uintveq(int4, uintv) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION int4uintvne(int4, uintv) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION int4uintvlt(int4, uintv) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION int4uintvle(int4, uintv) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION int4uintvgt(int4, uintv) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION int4uintvge(int4, uintv) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION int4uintv_cmp(int4, uintv) RETURNS INTEGER
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE OPERATOR > (
+    rightarg = uintv,
+    leftarg = int4,
+    procedure = int4uintvgt,
+    commutator = <,
+    negator = <=,
+    restrict = uint_scalargtsel,
+    join = scalargtjoinsel
+);
+
+CREATE OPERATOR < (
+    rightarg = uintv,
+    leftarg = int4,
+    procedure = int4uintvlt,
+    commutator = >,
+    negator = >=,
+    restrict = uint_scalarltsel,
+    join = scalarltjoinsel
+);
+
+CREATE OPERATOR <= (
+    rightarg = uintv,
+    leftarg = int4,
+    procedure = int4uintvle,
+    commutator = >=,
+    negator = >,
+    restrict = uint_scalarlesel,
+    join = scalarlejoinsel
+);
+
+CREATE OPERATOR >= (
+    rightarg = uintv,
+    leftarg = int4,
+    procedure = int4uintvge,
+    commutator = <=,
+    negator = <,
+    restrict = uint_scalargesel,
+    join = scalargejoinsel
+);
+
+CREATE OPERATOR = (
+    rightarg = uintv,
+    leftarg = int4,
+    procedure = int4uintveq,
+    commutator = =,
+    negator = <>,
+    restrict = eqsel,
+    join = eqjoinsel,
+    hashes,
+    merges
+);
+
+CREATE OPERATOR <> (
+    rightarg = uintv,
+    leftarg = int4,
+    procedure = int4uintvne,
+    commutator = <>,
+    negator = =,
+    restrict = neqsel,
+    join = neqjoinsel
+);
+
+CREATE FUNCTION uintvint8eq(uintv, int8) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uintvint8ne(uintv, int8) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uintvint8lt(uintv, int8) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uintvint8le(uintv, int8) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uintvint8gt(uintv, int8) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uintvint8ge(uintv, int8) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uintvint8_cmp(uintv, int8) RETURNS INTEGER
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE OPERATOR > (
+    rightarg = int8,
+    leftarg = uintv,
+    procedure = uintvint8gt,
+    commutator = <,
+    negator = <=,
+    restrict = uint_scalargtsel,
+    join = scalargtjoinsel
+);
+
+CREATE OPERATOR < (
+    rightarg = int8,
+    leftarg = uintv,
+    procedure = uintvint8lt,
+    commutator = >,
+    negator = >=,
+    restrict = uint_scalarltsel,
+    join = scalarltjoinsel
+);
+
+CREATE OPERATOR <= (
+    rightarg = int8,
+    leftarg = uintv,
+    procedure = uintvint8le,
+    commutator = >=,
+    negator = >,
+    restrict = uint_scalarlesel,
+    join = scalarlejoinsel
+);
+
+CREATE OPERATOR >= (
+    rightarg = int8,
+    leftarg = uintv,
+    procedure = uintvint8ge,
+    commutator = <=,
+    negator = <,
+    restrict = uint_scalargesel,
+    join = scalargejoinsel
+);
+
+CREATE OPERATOR = (
+    rightarg = int8,
+    leftarg = uintv,
+    procedure = uintvint8eq,
+    commutator = =,
+    negator = <>,
+    restrict = eqsel,
+    join = eqjoinsel,
+    hashes,
+    merges
+);
+
+CREATE OPERATOR <> (
+    rightarg = int8,
+    leftarg = uintv,
+    procedure = uintvint8ne,
+    commutator = <>,
+    negator = =,
+    restrict = neqsel,
+    join = neqjoinsel
+);
+
+CREATE FUNCTION int8uintveq(int8, uintv) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION int8uintvne(int8, uintv) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION int8uintvlt(int8, uintv) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION int8uintvle(int8, uintv) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION int8uintvgt(int8, uintv) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION int8uintvge(int8, uintv) RETURNS bool
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION int8uintv_cmp(int8, uintv) RETURNS INTEGER
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE OPERATOR > (
+    rightarg = uintv,
+    leftarg = int8,
+    procedure = int8uintvgt,
+    commutator = <,
+    negator = <=,
+    restrict = uint_scalargtsel,
+    join = scalargtjoinsel
+);
+
+CREATE OPERATOR < (
+    rightarg = uintv,
+    leftarg = int8,
+    procedure = int8uintvlt,
+    commutator = >,
+    negator = >=,
+    restrict = uint_scalarltsel,
+    join = scalarltjoinsel
+);
+
+CREATE OPERATOR <= (
+    rightarg = uintv,
+    leftarg = int8,
+    procedure = int8uintvle,
+    commutator = >=,
+    negator = >,
+    restrict = uint_scalarlesel,
+    join = scalarlejoinsel
+);
+
+CREATE OPERATOR >= (
+    rightarg = uintv,
+    leftarg = int8,
+    procedure = int8uintvge,
+    commutator = <=,
+    negator = <,
+    restrict = uint_scalargesel,
+    join = scalargejoinsel
+);
+
+CREATE OPERATOR = (
+    rightarg = uintv,
+    leftarg = int8,
+    procedure = int8uintveq,
+    commutator = =,
+    negator = <>,
+    restrict = eqsel,
+    join = eqjoinsel,
+    hashes,
+    merges
+);
+
+CREATE OPERATOR <> (
+    rightarg = uintv,
+    leftarg = int8,
+    procedure = int8uintvne,
+    commutator = <>,
+    negator = =,
+    restrict = neqsel,
+    join = neqjoinsel
+);
+
+-- Family members
+
+ALTER OPERATOR FAMILY uintv_ops_btree USING btree ADD
+        OPERATOR        1       < (uintv, uint2),
+        OPERATOR        2       <= (uintv, uint2),
+        OPERATOR        3       = (uintv, uint2),
+        OPERATOR        4       >= (uintv, uint2),
+        OPERATOR        5       > (uintv, uint2),
+        FUNCTION        1       (uintv, uint2) uintvuint2_cmp(uintv, uint2),
+        OPERATOR        1       < (uint2, uintv),
+        OPERATOR        2       <= (uint2, uintv),
+        OPERATOR        3       = (uint2, uintv),
+        OPERATOR        4       >= (uint2, uintv),
+        OPERATOR        5       > (uint2, uintv),
+        FUNCTION        1       (uint2, uintv) uint2uintv_cmp(uint2, uintv),
+        OPERATOR        1       < (uintv, uint4),
+        OPERATOR        2       <= (uintv, uint4),
+        OPERATOR        3       = (uintv, uint4),
+        OPERATOR        4       >= (uintv, uint4),
+        OPERATOR        5       > (uintv, uint4),
+        FUNCTION        1       (uintv, uint4) uintvuint4_cmp(uintv, uint4),
+        OPERATOR        1       < (uint4, uintv),
+        OPERATOR        2       <= (uint4, uintv),
+        OPERATOR        3       = (uint4, uintv),
+        OPERATOR        4       >= (uint4, uintv),
+        OPERATOR        5       > (uint4, uintv),
+        FUNCTION        1       (uint4, uintv) uint4uintv_cmp(uint4, uintv),
+        OPERATOR        1       < (uintv, uint8),
+        OPERATOR        2       <= (uintv, uint8),
+        OPERATOR        3       = (uintv, uint8),
+        OPERATOR        4       >= (uintv, uint8),
+        OPERATOR        5       > (uintv, uint8),
+        FUNCTION        1       (uintv, uint8) uintvuint8_cmp(uintv, uint8),
+        OPERATOR        1       < (uint8, uintv),
+        OPERATOR        2       <= (uint8, uintv),
+        OPERATOR        3       = (uint8, uintv),
+        OPERATOR        4       >= (uint8, uintv),
+        OPERATOR        5       > (uint8, uintv),
+        FUNCTION        1       (uint8, uintv) uint8uintv_cmp(uint8, uintv),
+        OPERATOR        1       < (uintv, int2),
+        OPERATOR        2       <= (uintv, int2),
+        OPERATOR        3       = (uintv, int2),
+        OPERATOR        4       >= (uintv, int2),
+        OPERATOR        5       > (uintv, int2),
+        FUNCTION        1       (uintv, int2) uintvint2_cmp(uintv, int2),
+        OPERATOR        1       < (int2, uintv),
+        OPERATOR        2       <= (int2, uintv),
+        OPERATOR        3       = (int2, uintv),
+        OPERATOR        4       >= (int2, uintv),
+        OPERATOR        5       > (int2, uintv),
+        FUNCTION        1       (int2, uintv) int2uintv_cmp(int2, uintv),
+        OPERATOR        1       < (uintv, int4),
+        OPERATOR        2       <= (uintv, int4),
+        OPERATOR        3       = (uintv, int4),
+        OPERATOR        4       >= (uintv, int4),
+        OPERATOR        5       > (uintv, int4),
+        FUNCTION        1       (uintv, int4) uintvint4_cmp(uintv, int4),
+        OPERATOR        1       < (int4, uintv),
+        OPERATOR        2       <= (int4, uintv),
+        OPERATOR        3       = (int4, uintv),
+        OPERATOR        4       >= (int4, uintv),
+        OPERATOR        5       > (int4, uintv),
+        FUNCTION        1       (int4, uintv) int4uintv_cmp(int4, uintv),
+        OPERATOR        1       < (uintv, int8),
+        OPERATOR        2       <= (uintv, int8),
+        OPERATOR        3       = (uintv, int8),
+        OPERATOR        4       >= (uintv, int8),
+        OPERATOR        5       > (uintv, int8),
+        FUNCTION        1       (uintv, int8) uintvint8_cmp(uintv, int8),
+        OPERATOR        1       < (int8, uintv),
+        OPERATOR        2       <= (int8, uintv),
+        OPERATOR        3       = (int8, uintv),
+        OPERATOR        4       >= (int8, uintv),
+        OPERATOR        5       > (int8, uintv),
+        FUNCTION        1       (int8, uintv) int8uintv_cmp(int8, uintv);
+
+ALTER OPERATOR FAMILY uintv_ops_hash USING hash ADD
+        OPERATOR        1       = (uintv, uint2),
+        OPERATOR        1       = (uint2, uintv),
+        OPERATOR        1       = (uintv, uint4),
+        OPERATOR        1       = (uint4, uintv),
+        OPERATOR        1       = (uintv, uint8),
+        OPERATOR        1       = (uint8, uintv),
+        OPERATOR        1       = (uintv, int2),
+        OPERATOR        1       = (int2, uintv),
+        OPERATOR        1       = (uintv, int4),
+        OPERATOR        1       = (int4, uintv),
+        OPERATOR        1       = (uintv, int8),
+        OPERATOR        1       = (int8, uintv),
+        FUNCTION        1       (uint2) uint2_hash(uint2),
+        FUNCTION        1       (uint4) uint4_hash(uint4),
+        FUNCTION        1       (uint8) uint8_hash(uint8),
+        FUNCTION        1       (int2) hashint2(int2),
+        FUNCTION        1       (int4) hashint4(int4),
+        FUNCTION        1       (int8) hashint8(int8),
+        FUNCTION        2       (uint2) uint2_hash_extended(uint2, int8),
+        FUNCTION        2       (uint4) uint4_hash_extended(uint4, int8),
+        FUNCTION        2       (uint8) uint8_hash_extended(uint8, int8),
+        FUNCTION        2       (int2) hashint2extended(int2, int8),
+        FUNCTION        2       (int4) hashint4extended(int4, int8),
+        FUNCTION        2       (int8) hashint8extended(int8, int8);
+
+
+-- UINT V aggregates
+--
+-- min and max keep their result in uintv, and can be answered from an
+-- index; the other aggregates go through uint8.
+
+CREATE FUNCTION uintvlarger(uintv, uintv) RETURNS uintv
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE FUNCTION uintvsmaller(uintv, uintv) RETURNS uintv
+AS 'MODULE_PATHNAME'
+LANGUAGE C STRICT IMMUTABLE PARALLEL SAFE;
+
+CREATE AGGREGATE min(uintv) (
+    SFUNC = uintvsmaller,
+    STYPE = uintv,
+    COMBINEFUNC = uintvsmaller,
+    SORTOP = <,
+    PARALLEL = SAFE
+);
+
+CREATE AGGREGATE max(uintv) (
+    SFUNC = uintvlarger,
+    STYPE = uintv,
+    COMBINEFUNC = uintvlarger,
+    SORTOP = >,
+    PARALLEL = SAFE
+);
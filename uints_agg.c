@@ -0,0 +1,331 @@
+/*-------------------------------------------------------------------------
+ *
+ * uints_agg.c
+ *	  Aggregate support functions for unsigned integer types
+ *
+ *	  sum() of uint1/uint2/uint4 accumulates into a uint8.  sum() of uint8
+ *	  and avg() of every width keep a 128-bit sum (as two uint64 halves)
+ *	  plus a count in an internal state, which has combine, serialize and
+ *	  deserialize functions so the aggregates can run in parallel.
+ *
+ * Portions Copyright (c) 1996-2013, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include "fmgr.h"
+#include "libpq/pqformat.h"
+#include "utils/builtins.h"
+#include "utils/numeric.h"
+#if PG_VERSION_NUM >= 160000
+#include "varatt.h"
+#endif
+
+#include "declare.h"
+#include "uints_fmgr.h"
+
+/* Defined in uint8.c */
+extern Datum u8tonumeric(PG_FUNCTION_ARGS);
+
+typedef struct
+{
+	int64		N;				/* count of non-null inputs */
+	uint64		sumHi;			/* high 64 bits of the sum */
+	uint64		sumLo;			/* low 64 bits of the sum */
+} UintAggState;
+
+
+/*
+ *		=====================================
+ *		SUM OF NARROW TYPES, WIDENED TO UINT8
+ *		=====================================
+ *
+ * These are not strict: a NULL state means no non-null input has been seen
+ * yet, and NULL inputs leave the state alone.  The combine function is the
+ * strict uint8pl.
+ */
+
+static inline
+uint64
+uint_sum_add(uint64 oldsum, uint64 newval)
+{
+	if (oldsum > PG_UINT64_MAX - newval)
+		report_out_of_range();
+
+	return oldsum + newval;
+}
+
+DECLARE(uint1_sum)
+Datum
+uint1_sum(PG_FUNCTION_ARGS)
+{
+	if (PG_ARGISNULL(0))
+	{
+		if (PG_ARGISNULL(1))
+			PG_RETURN_NULL();
+		PG_RETURN_UINT64((uint64) PG_GETARG_UINT8(1));
+	}
+
+	if (PG_ARGISNULL(1))
+		PG_RETURN_DATUM(PG_GETARG_DATUM(0));
+
+	PG_RETURN_UINT64(uint_sum_add(PG_GETARG_UINT64(0),
+								  (uint64) PG_GETARG_UINT8(1)));
+}
+
+DECLARE(uint2_sum)
+Datum
+uint2_sum(PG_FUNCTION_ARGS)
+{
+	if (PG_ARGISNULL(0))
+	{
+		if (PG_ARGISNULL(1))
+			PG_RETURN_NULL();
+		PG_RETURN_UINT64((uint64) PG_GETARG_UINT16(1));
+	}
+
+	if (PG_ARGISNULL(1))
+		PG_RETURN_DATUM(PG_GETARG_DATUM(0));
+
+	PG_RETURN_UINT64(uint_sum_add(PG_GETARG_UINT64(0),
+								  (uint64) PG_GETARG_UINT16(1)));
+}
+
+DECLARE(uint4_sum)
+Datum
+uint4_sum(PG_FUNCTION_ARGS)
+{
+	if (PG_ARGISNULL(0))
+	{
+		if (PG_ARGISNULL(1))
+			PG_RETURN_NULL();
+		PG_RETURN_UINT64((uint64) PG_GETARG_UINT32(1));
+	}
+
+	if (PG_ARGISNULL(1))
+		PG_RETURN_DATUM(PG_GETARG_DATUM(0));
+
+	PG_RETURN_UINT64(uint_sum_add(PG_GETARG_UINT64(0),
+								  (uint64) PG_GETARG_UINT32(1)));
+}
+
+
+/*
+ *		==========================
+ *		128-BIT SUM AND AVG STATES
+ *		==========================
+ */
+
+static UintAggState *
+makeUintAggState(FunctionCallInfo fcinfo)
+{
+	MemoryContext agg_context;
+
+	if (!AggCheckCallContext(fcinfo, &agg_context))
+		elog(ERROR, "aggregate function called in non-aggregate context");
+
+	return (UintAggState *) MemoryContextAllocZero(agg_context,
+												   sizeof(UintAggState));
+}
+
+static inline
+void
+uint_agg_accum(UintAggState *state, uint64 newval)
+{
+	state->N++;
+	state->sumLo += newval;
+	/* carry into the high half */
+	if (state->sumLo < newval)
+		state->sumHi++;
+}
+
+/*
+ * Transition function shared by the accumulators below.  Not strict, so
+ * that the state is created on the first call even for a NULL input.
+ */
+#define UINT_AGG_ACCUM_BODY(getarg) \
+	UintAggState *state; \
+	\
+	state = PG_ARGISNULL(0) ? NULL : (UintAggState *) PG_GETARG_POINTER(0); \
+	\
+	if (state == NULL) \
+		state = makeUintAggState(fcinfo); \
+	\
+	if (!PG_ARGISNULL(1)) \
+		uint_agg_accum(state, (uint64) getarg(1)); \
+	\
+	PG_RETURN_POINTER(state)
+
+DECLARE(uint1_avg_accum)
+Datum
+uint1_avg_accum(PG_FUNCTION_ARGS)
+{
+	UINT_AGG_ACCUM_BODY(PG_GETARG_UINT8);
+}
+
+DECLARE(uint2_avg_accum)
+Datum
+uint2_avg_accum(PG_FUNCTION_ARGS)
+{
+	UINT_AGG_ACCUM_BODY(PG_GETARG_UINT16);
+}
+
+DECLARE(uint4_avg_accum)
+Datum
+uint4_avg_accum(PG_FUNCTION_ARGS)
+{
+	UINT_AGG_ACCUM_BODY(PG_GETARG_UINT32);
+}
+
+DECLARE(uint8_avg_accum)
+Datum
+uint8_avg_accum(PG_FUNCTION_ARGS)
+{
+	UINT_AGG_ACCUM_BODY(PG_GETARG_UINT64);
+}
+
+DECLARE(uint8_avg_combine)
+Datum
+uint8_avg_combine(PG_FUNCTION_ARGS)
+{
+	UintAggState *state1;
+	UintAggState *state2;
+
+	state1 = PG_ARGISNULL(0) ? NULL : (UintAggState *) PG_GETARG_POINTER(0);
+	state2 = PG_ARGISNULL(1) ? NULL : (UintAggState *) PG_GETARG_POINTER(1);
+
+	if (state2 == NULL)
+		PG_RETURN_POINTER(state1);
+
+	/* manually copy all fields from state2 to state1 */
+	if (state1 == NULL)
+	{
+		state1 = makeUintAggState(fcinfo);
+		*state1 = *state2;
+		PG_RETURN_POINTER(state1);
+	}
+
+	state1->N += state2->N;
+	state1->sumHi += state2->sumHi;
+	state1->sumLo += state2->sumLo;
+	if (state1->sumLo < state2->sumLo)
+		state1->sumHi++;
+
+	PG_RETURN_POINTER(state1);
+}
+
+DECLARE(uint8_avg_serialize)
+Datum
+uint8_avg_serialize(PG_FUNCTION_ARGS)
+{
+	UintAggState *state;
+	StringInfoData buf;
+
+	/* Ensure we disallow calling when not in aggregate context */
+	if (!AggCheckCallContext(fcinfo, NULL))
+		elog(ERROR, "aggregate function called in non-aggregate context");
+
+	state = (UintAggState *) PG_GETARG_POINTER(0);
+
+	pq_begintypsend(&buf);
+	pq_sendint64(&buf, state->N);
+	pq_sendint64(&buf, state->sumHi);
+	pq_sendint64(&buf, state->sumLo);
+
+	PG_RETURN_BYTEA_P(pq_endtypsend(&buf));
+}
+
+DECLARE(uint8_avg_deserialize)
+Datum
+uint8_avg_deserialize(PG_FUNCTION_ARGS)
+{
+	bytea	   *sstate;
+	UintAggState *result;
+	StringInfoData buf;
+
+	if (!AggCheckCallContext(fcinfo, NULL))
+		elog(ERROR, "aggregate function called in non-aggregate context");
+
+	sstate = PG_GETARG_BYTEA_PP(0);
+
+	/*
+	 * Copy the bytea into a StringInfo so that we can "receive" it using the
+	 * standard recv-function infrastructure.
+	 */
+	initStringInfo(&buf);
+	appendBinaryStringInfo(&buf,
+						   VARDATA_ANY(sstate), VARSIZE_ANY_EXHDR(sstate));
+
+	result = makeUintAggState(fcinfo);
+	result->N = pq_getmsgint64(&buf);
+	result->sumHi = (uint64) pq_getmsgint64(&buf);
+	result->sumLo = (uint64) pq_getmsgint64(&buf);
+
+	pq_getmsgend(&buf);
+	pfree(buf.data);
+
+	PG_RETURN_POINTER(result);
+}
+
+/* Convert the 128-bit sum held in a state to numeric */
+static Datum
+uint_agg_sum_numeric(UintAggState *state)
+{
+	Datum		result;
+
+	result = DirectFunctionCall1(u8tonumeric, UInt64GetDatum(state->sumLo));
+
+	if (state->sumHi != 0)
+	{
+		Datum		base;
+		Datum		high;
+
+		base = DirectFunctionCall3(numeric_in,
+								   CStringGetDatum("18446744073709551616"),
+								   ObjectIdGetDatum(InvalidOid),
+								   Int32GetDatum(-1));
+		high = DirectFunctionCall1(u8tonumeric, UInt64GetDatum(state->sumHi));
+		high = DirectFunctionCall2(numeric_mul, high, base);
+		result = DirectFunctionCall2(numeric_add, high, result);
+	}
+
+	return result;
+}
+
+DECLARE(uint8_sum_final)
+Datum
+uint8_sum_final(PG_FUNCTION_ARGS)
+{
+	UintAggState *state;
+
+	state = PG_ARGISNULL(0) ? NULL : (UintAggState *) PG_GETARG_POINTER(0);
+
+	/* If there were no non-null inputs, return NULL */
+	if (state == NULL || state->N == 0)
+		PG_RETURN_NULL();
+
+	PG_RETURN_DATUM(uint_agg_sum_numeric(state));
+}
+
+DECLARE(uint8_avg_final)
+Datum
+uint8_avg_final(PG_FUNCTION_ARGS)
+{
+	UintAggState *state;
+	Datum		count;
+
+	state = PG_ARGISNULL(0) ? NULL : (UintAggState *) PG_GETARG_POINTER(0);
+
+	/* If there were no non-null inputs, return NULL */
+	if (state == NULL || state->N == 0)
+		PG_RETURN_NULL();
+
+	count = DirectFunctionCall1(int8_numeric, Int64GetDatum(state->N));
+
+	PG_RETURN_DATUM(DirectFunctionCall2(numeric_div,
+										uint_agg_sum_numeric(state),
+										count));
+}
@@ -0,0 +1,438 @@
+/*-------------------------------------------------------------------------
+ *
+ * uints_array.c
+ *	  intarray-style functions on uint4[] and uint8[]
+ *
+ *	  icount, sort, uniq, idx and the "#", "&" and "|" operators, as in
+ *	  contrib/intarray.  The arrays must be one-dimensional and must not
+ *	  contain NULLs, which lets the code work directly on the element data.
+ *	  Sorting uses a specialised sort per element width, and intersection
+ *	  and union are linear merges of sorted inputs.
+ *
+ * Portions Copyright (c) 1996-2013, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include <ctype.h>
+
+#include "fmgr.h"
+#include "utils/array.h"
+#include "utils/builtins.h"
+
+#include "declare.h"
+#include "uints_array.h"
+#include "uints_fmgr.h"
+#include "uints_numutils.h"
+
+#define ST_SORT sort_uint32
+#define ST_ELEMENT_TYPE uint32
+#define ST_COMPARE(a, b) ((*(a) > *(b)) - (*(a) < *(b)))
+#define ST_SCOPE static
+#define ST_DEFINE
+#include "lib/sort_template.h"
+
+#define ST_SORT sort_uint64
+#define ST_ELEMENT_TYPE uint64
+#define ST_COMPARE(a, b) ((*(a) > *(b)) - (*(a) < *(b)))
+#define ST_SCOPE static
+#define ST_DEFINE
+#include "lib/sort_template.h"
+
+#define ARRNELEMS(a)	ArrayGetNItems(ARR_NDIM(a), ARR_DIMS(a))
+
+static void
+check_uint_array(ArrayType *a)
+{
+	if (ARR_NDIM(a) > 1)
+		ereport(ERROR,
+				(errcode(ERRCODE_ARRAY_SUBSCRIPT_ERROR),
+				 errmsg("array must be one-dimensional")));
+
+	if (array_contains_nulls(a))
+		ereport(ERROR,
+				(errcode(ERRCODE_NULL_VALUE_NOT_ALLOWED),
+				 errmsg("array must not contain nulls")));
+}
+
+/* Build a one-dimensional array of n elements of elemsize bytes each */
+ArrayType *
+make_uint_array(const void *data, int n, Oid elemtype, int elemsize)
+{
+	ArrayType  *result;
+	Size		nbytes;
+
+	if (n == 0)
+		return construct_empty_array(elemtype);
+
+	nbytes = ARR_OVERHEAD_NONULLS(1) + (Size) elemsize * n;
+	result = (ArrayType *) palloc0(nbytes);
+	SET_VARSIZE(result, nbytes);
+	result->ndim = 1;
+	result->dataoffset = 0;
+	result->elemtype = elemtype;
+	*ARR_DIMS(result) = n;
+	*ARR_LBOUND(result) = 1;
+	memcpy(ARR_DATA_PTR(result), data, (Size) elemsize * n);
+
+	return result;
+}
+
+/* Is dirstr "ASC" (false) or "DESC" (true)? */
+static bool
+sort_descending(text *dirstr)
+{
+	char	   *d = text_to_cstring(dirstr);
+
+	if (pg_strcasecmp(d, "ASC") == 0)
+		return false;
+	if (pg_strcasecmp(d, "DESC") == 0)
+		return true;
+
+	ereport(ERROR,
+			(errcode(ERRCODE_INVALID_PARAMETER_VALUE),
+			 errmsg("second parameter must be \"ASC\" or \"DESC\"")));
+	return false;				/* keep compiler quiet */
+}
+
+/*
+ * Helpers working on plain C arrays of one element type.  The merges
+ * advance both inputs with comparisons instead of branches, which keeps
+ * the loops free of hard-to-predict jumps.
+ */
+#define UINT_ARRAY_HELPERS(T, sortfn) \
+static T * \
+T##_copy_sorted(ArrayType *a, int *n) \
+{ \
+	T		   *data; \
+	\
+	*n = ARRNELEMS(a); \
+	data = (T *) palloc(sizeof(T) * Max(*n, 1)); \
+	memcpy(data, ARR_DATA_PTR(a), sizeof(T) * *n); \
+	sortfn(data, *n); \
+	return data; \
+} \
+\
+/* Remove adjacent duplicates in place, returning the new length */ \
+static int \
+T##_uniq(T *data, int n) \
+{ \
+	int			i; \
+	int			k = 0; \
+	\
+	if (n == 0) \
+		return 0; \
+	for (i = 1; i < n; i++) \
+	{ \
+		data[k + 1] = data[i]; \
+		k += (data[i] != data[k]); \
+	} \
+	return k + 1; \
+} \
+\
+static void \
+T##_reverse(T *data, int n) \
+{ \
+	int			i; \
+	\
+	for (i = 0; i < n / 2; i++) \
+	{ \
+		T			tmp = data[i]; \
+		\
+		data[i] = data[n - 1 - i]; \
+		data[n - 1 - i] = tmp; \
+	} \
+} \
+\
+/* Intersection of two sorted, duplicate-free arrays */ \
+static int \
+T##_intersect(const T *a, int na, const T *b, int nb, T *out) \
+{ \
+	int			i = 0; \
+	int			j = 0; \
+	int			k = 0; \
+	\
+	while (i < na && j < nb) \
+	{ \
+		T			x = a[i]; \
+		T			y = b[j]; \
+		\
+		out[k] = x; \
+		k += (x == y); \
+		i += (x <= y); \
+		j += (y <= x); \
+	} \
+	return k; \
+} \
+\
+/* Union of two sorted, duplicate-free arrays */ \
+static int \
+T##_union(const T *a, int na, const T *b, int nb, T *out) \
+{ \
+	int			i = 0; \
+	int			j = 0; \
+	int			k = 0; \
+	\
+	while (i < na && j < nb) \
+	{ \
+		T			x = a[i]; \
+		T			y = b[j]; \
+		\
+		out[k++] = (x <= y) ? x : y; \
+		i += (x <= y); \
+		j += (y <= x); \
+	} \
+	while (i < na) \
+		out[k++] = a[i++]; \
+	while (j < nb) \
+		out[k++] = b[j++]; \
+	return k; \
+}
+
+UINT_ARRAY_HELPERS(uint32, sort_uint32)
+UINT_ARRAY_HELPERS(uint64, sort_uint64)
+
+/* Sort values and remove duplicates, returning the new count */
+int
+uint32_sort_unique(uint32 *data, int n)
+{
+	sort_uint32(data, n);
+	return uint32_uniq(data, n);
+}
+
+/*
+ * Parse the len bytes at p as one uint4 list element.  They are copied out
+ * so that an error quotes only this element and not the rest of the list;
+ * any valid element fits the stack buffer, whitespace and zeros aside.
+ */
+static uint32
+uint4_list_item(const char *p, int len)
+{
+	char		buf[32];
+	char	   *item = (len < (int) sizeof(buf)) ? buf : palloc(len + 1);
+	uint32		result;
+
+	memcpy(item, p, len);
+	item[len] = '\0';
+	result = pg_atou4(item, '\0');
+	if (item != buf)
+		pfree(item);
+
+	return result;
+}
+
+/*
+ * Parse a "{v1,v2,...}" literal of uint4 values, in any order and with
+ * duplicates, for the input function of type.  Returns the values, sorted
+ * and distinct, and sets *n to their count.
+ */
+uint32 *
+uint4_list_in(char *str, const char *type, int *n)
+{
+	char	   *p = str;
+	uint32	   *values;
+	int			count = 0;
+	int			size = 64;
+
+	while (isspace((unsigned char) *p))
+		p++;
+	if (*p++ != '{')
+		goto malformed;
+
+	values = (uint32 *) palloc(sizeof(uint32) * size);
+
+	while (isspace((unsigned char) *p))
+		p++;
+	if (*p == '}')
+		p++;
+	else
+	{
+		for (;;)
+		{
+			char	   *end = strpbrk(p, ",}");
+
+			if (end == NULL)
+				goto malformed;
+			if (count == size)
+			{
+				size *= 2;
+				values = (uint32 *) repalloc_huge(values, sizeof(uint32) * size);
+			}
+			values[count++] = uint4_list_item(p, end - p);
+			p = end + 1;
+			if (*end == '}')
+				break;
+		}
+	}
+
+	while (isspace((unsigned char) *p))
+		p++;
+	if (*p != '\0')
+		goto malformed;
+
+	*n = uint32_sort_unique(values, count);
+	return values;
+
+malformed:
+	ereport(ERROR,
+			(errcode(ERRCODE_INVALID_TEXT_REPRESENTATION),
+			 errmsg("malformed %s literal: \"%s\"", type, str)));
+	return NULL;				/* keep compiler quiet */
+}
+
+/*
+ * SQL-callable functions for one element type.  T is the C type and GETARG
+ * fetches a scalar argument of it.
+ */
+#define UINT_ARRAY_FUNCS(type, T, GETARG) \
+DECLARE(type##_array_icount) \
+Datum \
+type##_array_icount(PG_FUNCTION_ARGS) \
+{ \
+	ArrayType  *a = PG_GETARG_ARRAYTYPE_P(0); \
+	\
+	check_uint_array(a); \
+	PG_RETURN_INT32(ARRNELEMS(a)); \
+} \
+\
+DECLARE(type##_array_sort) \
+Datum \
+type##_array_sort(PG_FUNCTION_ARGS) \
+{ \
+	ArrayType  *a = PG_GETARG_ARRAYTYPE_P(0); \
+	T		   *data; \
+	int			n; \
+	\
+	check_uint_array(a); \
+	data = T##_copy_sorted(a, &n); \
+	PG_RETURN_ARRAYTYPE_P(make_uint_array(data, n, ARR_ELEMTYPE(a), \
+										  sizeof(T))); \
+} \
+\
+DECLARE(type##_array_sort_desc) \
+Datum \
+type##_array_sort_desc(PG_FUNCTION_ARGS) \
+{ \
+	ArrayType  *a = PG_GETARG_ARRAYTYPE_P(0); \
+	T		   *data; \
+	int			n; \
+	\
+	check_uint_array(a); \
+	data = T##_copy_sorted(a, &n); \
+	T##_reverse(data, n); \
+	PG_RETURN_ARRAYTYPE_P(make_uint_array(data, n, ARR_ELEMTYPE(a), \
+										  sizeof(T))); \
+} \
+\
+DECLARE(type##_array_sort_dir) \
+Datum \
+type##_array_sort_dir(PG_FUNCTION_ARGS) \
+{ \
+	ArrayType  *a = PG_GETARG_ARRAYTYPE_P(0); \
+	bool		desc = sort_descending(PG_GETARG_TEXT_PP(1)); \
+	T		   *data; \
+	int			n; \
+	\
+	check_uint_array(a); \
+	data = T##_copy_sorted(a, &n); \
+	if (desc) \
+		T##_reverse(data, n); \
+	PG_RETURN_ARRAYTYPE_P(make_uint_array(data, n, ARR_ELEMTYPE(a), \
+										  sizeof(T))); \
+} \
+\
+/* Like intarray's uniq, this only removes adjacent duplicates */ \
+DECLARE(type##_array_uniq) \
+Datum \
+type##_array_uniq(PG_FUNCTION_ARGS) \
+{ \
+	ArrayType  *a = PG_GETARG_ARRAYTYPE_P(0); \
+	T		   *data; \
+	int			n; \
+	\
+	check_uint_array(a); \
+	n = ARRNELEMS(a); \
+	data = (T *) palloc(sizeof(T) * Max(n, 1)); \
+	memcpy(data, ARR_DATA_PTR(a), sizeof(T) * n); \
+	n = T##_uniq(data, n); \
+	PG_RETURN_ARRAYTYPE_P(make_uint_array(data, n, ARR_ELEMTYPE(a), \
+										  sizeof(T))); \
+} \
+\
+/* 1-based position of the first occurrence of elem, or 0 */ \
+DECLARE(type##_array_idx) \
+Datum \
+type##_array_idx(PG_FUNCTION_ARGS) \
+{ \
+	ArrayType  *a = PG_GETARG_ARRAYTYPE_P(0); \
+	T			elem = GETARG(1); \
+	const T    *data; \
+	int			n; \
+	int			i; \
+	\
+	check_uint_array(a); \
+	n = ARRNELEMS(a); \
+	data = (const T *) ARR_DATA_PTR(a); \
+	for (i = 0; i < n; i++) \
+	{ \
+		if (data[i] == elem) \
+			PG_RETURN_INT32(i + 1); \
+	} \
+	PG_RETURN_INT32(0); \
+} \
+\
+DECLARE(type##_array_inter) \
+Datum \
+type##_array_inter(PG_FUNCTION_ARGS) \
+{ \
+	ArrayType  *a = PG_GETARG_ARRAYTYPE_P(0); \
+	ArrayType  *b = PG_GETARG_ARRAYTYPE_P(1); \
+	T		   *da; \
+	T		   *db; \
+	T		   *out; \
+	int			na; \
+	int			nb; \
+	int			n; \
+	\
+	check_uint_array(a); \
+	check_uint_array(b); \
+	da = T##_copy_sorted(a, &na); \
+	db = T##_copy_sorted(b, &nb); \
+	na = T##_uniq(da, na); \
+	nb = T##_uniq(db, nb); \
+	out = (T *) palloc(sizeof(T) * Max(Min(na, nb), 1)); \
+	n = T##_intersect(da, na, db, nb, out); \
+	PG_RETURN_ARRAYTYPE_P(make_uint_array(out, n, ARR_ELEMTYPE(a), \
+										  sizeof(T))); \
+} \
+\
+DECLARE(type##_array_union) \
+Datum \
+type##_array_union(PG_FUNCTION_ARGS) \
+{ \
+	ArrayType  *a = PG_GETARG_ARRAYTYPE_P(0); \
+	ArrayType  *b = PG_GETARG_ARRAYTYPE_P(1); \
+	T		   *da; \
+	T		   *db; \
+	T		   *out; \
+	int			na; \
+	int			nb; \
+	int			n; \
+	\
+	check_uint_array(a); \
+	check_uint_array(b); \
+	da = T##_copy_sorted(a, &na); \
+	db = T##_copy_sorted(b, &nb); \
+	na = T##_uniq(da, na); \
+	nb = T##_uniq(db, nb); \
+	out = (T *) palloc(sizeof(T) * Max(na + nb, 1)); \
+	n = T##_union(da, na, db, nb, out); \
+	PG_RETURN_ARRAYTYPE_P(make_uint_array(out, n, ARR_ELEMTYPE(a), \
+										  sizeof(T))); \
+}
+
+UINT_ARRAY_FUNCS(uint4, uint32, PG_GETARG_UINT32)
+UINT_ARRAY_FUNCS(uint8, uint64, PG_GETARG_UINT64)
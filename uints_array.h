@@ -0,0 +1,24 @@
+/*-------------------------------------------------------------------------
+ *
+ * uints_array.h
+ *	  Helpers shared by the array, set and bitmap functions.
+ *
+ *
+ * Portions Copyright (c) 1996-2013, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ *
+ *-------------------------------------------------------------------------
+ */
+#ifndef UINTS_ARRAY_H
+#define UINTS_ARRAY_H
+
+#include "utils/array.h"
+
+/* uints_array.c */
+extern ArrayType *make_uint_array(const void *data, int n, Oid elemtype,
+								  int elemsize);
+extern int uint32_sort_unique(uint32 *data, int n);
+extern uint32 *uint4_list_in(char *str, const char *type, int *n);
+
+#endif
@@ -0,0 +1,1016 @@
+/*-------------------------------------------------------------------------
+ *
+ * uints_bitmap.c
+ *	  uint4bitmap, a Roaring bitmap of uint4 values
+ *
+ *	  Values are grouped by their high 16 bits into containers.  A container
+ *	  holding up to BITMAP_ARRAY_MAX values stores their low halves as a
+ *	  sorted uint16 array; a fuller one is a bitmap of all 65536 low values.
+ *	  Either way a container never takes more than 8kB, and set operations
+ *	  work container by container.
+ *
+ *	  The stored form is a flat varlena, which contains checks and the value
+ *	  iterator read in place.  Aggregation and the set operators work on a
+ *	  BitmapState, which may point into stored bitmaps or own its containers.
+ *	  uint4bitmap_agg's serialized state is the stored form.
+ *
+ * Portions Copyright (c) 1996-2013, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include "fmgr.h"
+#include "funcapi.h"
+#include "lib/stringinfo.h"
+#include "port/pg_bitutils.h"
+
+#include "declare.h"
+#include "uints_array.h"
+#include "uints_fmgr.h"
+#include "uints_numutils.h"
+
+#define BITMAP_ARRAY_MAX	4096
+#define BITMAP_WORDS		(65536 / 64)
+
+typedef struct
+{
+	int32		vl_len_;		/* varlena header (do not touch directly!) */
+	uint32		ncontainers;
+	/* Uint4BitmapContainer containers[ncontainers], then the payloads */
+} Uint4Bitmap;
+
+typedef struct
+{
+	uint16		key;			/* high 16 bits of the values */
+	uint16		pad;
+	uint32		cardinality;	/* 1..65536, a bitmap if > BITMAP_ARRAY_MAX */
+	uint32		offset;			/* payload offset from the start of the datum */
+} Uint4BitmapContainer;
+
+#define UINT4BITMAP_CONTAINERS(b) \
+	((const Uint4BitmapContainer *) ((const char *) (b) + sizeof(Uint4Bitmap)))
+#define UINT4BITMAP_PAYLOAD(b, c) \
+	((const void *) ((const char *) (b) + (c)->offset))
+
+#define PG_GETARG_UINT4BITMAP_P(n) ((Uint4Bitmap *) PG_DETOAST_DATUM(PG_GETARG_DATUM(n)))
+
+/*
+ * Working form of a container.  Exactly one of array and bits is set.
+ * capacity is zero for containers that point into a stored bitmap, which
+ * must not be modified.
+ */
+typedef struct
+{
+	uint16		key;
+	int			cardinality;
+	int			capacity;		/* allocated length of array */
+	uint16	   *array;
+	uint64	   *bits;
+} Container;
+
+typedef struct
+{
+	int			n;
+	int			capacity;
+	Container  *c;				/* sorted by key */
+} BitmapState;
+
+typedef enum
+{
+	BITMAP_AND,
+	BITMAP_OR,
+	BITMAP_XOR,
+	BITMAP_ANDNOT
+} BitmapOp;
+
+
+/*
+ *		==========
+ *		CONTAINERS
+ *		==========
+ */
+
+static int
+bits_to_array(const uint64 *bits, uint16 *out)
+{
+	int			n = 0;
+	int			w;
+
+	for (w = 0; w < BITMAP_WORDS; w++)
+	{
+		uint64		word = bits[w];
+
+		while (word != 0)
+		{
+			out[n++] = w * 64 + pg_rightmost_one_pos64(word);
+			word &= word - 1;
+		}
+	}
+	return n;
+}
+
+static void
+array_to_bits(const uint16 *array, int n, uint64 *bits)
+{
+	int			i;
+
+	for (i = 0; i < n; i++)
+		bits[array[i] >> 6] |= UINT64CONST(1) << (array[i] & 63);
+}
+
+/* Index of low in a sorted array, or where it would go as -(pos + 1) */
+static int
+array_search(const uint16 *array, int n, uint16 low)
+{
+	int			lo = 0;
+	int			hi = n;
+
+	while (lo < hi)
+	{
+		int			mid = lo + (hi - lo) / 2;
+
+		if (array[mid] < low)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	if (lo < n && array[lo] == low)
+		return lo;
+	return -(lo + 1);
+}
+
+/* Merge two sorted arrays, keeping the values op selects */
+static int
+array_op(BitmapOp op, const uint16 *a, int na, const uint16 *b, int nb,
+		 uint16 *out)
+{
+	bool		keep_a = (op != BITMAP_AND);
+	bool		keep_b = (op == BITMAP_OR || op == BITMAP_XOR);
+	bool		keep_both = (op == BITMAP_AND || op == BITMAP_OR);
+	int			i = 0;
+	int			j = 0;
+	int			k = 0;
+
+	while (i < na && j < nb)
+	{
+		if (a[i] < b[j])
+		{
+			if (keep_a)
+				out[k++] = a[i];
+			i++;
+		}
+		else if (b[j] < a[i])
+		{
+			if (keep_b)
+				out[k++] = b[j];
+			j++;
+		}
+		else
+		{
+			if (keep_both)
+				out[k++] = a[i];
+			i++;
+			j++;
+		}
+	}
+	if (keep_a)
+		while (i < na)
+			out[k++] = a[i++];
+	if (keep_b)
+		while (j < nb)
+			out[k++] = b[j++];
+
+	return k;
+}
+
+static void
+container_make_bitmap(Container *c)
+{
+	uint64	   *bits = palloc0(BITMAP_WORDS * sizeof(uint64));
+
+	array_to_bits(c->array, c->cardinality, bits);
+	if (c->capacity > 0)
+		pfree(c->array);
+	c->array = NULL;
+	c->capacity = 0;
+	c->bits = bits;
+}
+
+/*
+ * Set c to the values in bits, as an array if there are few enough.  Takes
+ * ownership of bits.
+ */
+static void
+container_set_bits(Container *c, uint64 *bits)
+{
+	c->cardinality = pg_popcount((const char *) bits,
+								 BITMAP_WORDS * sizeof(uint64));
+	if (c->cardinality > BITMAP_ARRAY_MAX)
+	{
+		c->array = NULL;
+		c->capacity = 0;
+		c->bits = bits;
+	}
+	else
+	{
+		c->array = palloc(Max(c->cardinality, 1) * sizeof(uint16));
+		c->capacity = Max(c->cardinality, 1);
+		c->bits = NULL;
+		bits_to_array(bits, c->array);
+		pfree(bits);
+	}
+}
+
+static void
+container_add(Container *c, uint16 low)
+{
+	int			pos;
+
+	if (c->bits)
+	{
+		uint64		mask = UINT64CONST(1) << (low & 63);
+
+		if ((c->bits[low >> 6] & mask) == 0)
+		{
+			c->bits[low >> 6] |= mask;
+			c->cardinality++;
+		}
+		return;
+	}
+
+	/* sorted input appends */
+	if (c->cardinality == 0 || c->array[c->cardinality - 1] < low)
+		pos = c->cardinality;
+	else
+	{
+		pos = array_search(c->array, c->cardinality, low);
+		if (pos >= 0)
+			return;
+		pos = -pos - 1;
+	}
+
+	if (c->cardinality == BITMAP_ARRAY_MAX)
+	{
+		container_make_bitmap(c);
+		container_add(c, low);
+		return;
+	}
+	if (c->cardinality == c->capacity)
+	{
+		c->capacity = Min(Max(c->capacity * 2, 4), BITMAP_ARRAY_MAX);
+		c->array = c->array ? repalloc(c->array, c->capacity * sizeof(uint16))
+			: palloc(c->capacity * sizeof(uint16));
+	}
+	memmove(c->array + pos + 1, c->array + pos,
+			(c->cardinality - pos) * sizeof(uint16));
+	c->array[pos] = low;
+	c->cardinality++;
+}
+
+/* Copy src into dst, which then owns its payload */
+static void
+container_copy(Container *dst, const Container *src)
+{
+	*dst = *src;
+	if (src->bits)
+	{
+		dst->bits = palloc(BITMAP_WORDS * sizeof(uint64));
+		memcpy(dst->bits, src->bits, BITMAP_WORDS * sizeof(uint64));
+	}
+	else
+	{
+		dst->capacity = src->cardinality;
+		dst->array = palloc(src->cardinality * sizeof(uint16));
+		memcpy(dst->array, src->array, src->cardinality * sizeof(uint16));
+	}
+}
+
+/* Add the values of src to dst, which must own its payload */
+static void
+container_or_into(Container *dst, const Container *src)
+{
+	int			w;
+
+	if (!dst->bits && !src->bits &&
+		dst->cardinality + src->cardinality <= BITMAP_ARRAY_MAX)
+	{
+		uint16	   *out = palloc((dst->cardinality + src->cardinality) *
+								 sizeof(uint16));
+
+		dst->cardinality = array_op(BITMAP_OR,
+									dst->array, dst->cardinality,
+									src->array, src->cardinality, out);
+		pfree(dst->array);
+		dst->array = out;
+		dst->capacity = dst->cardinality;
+		return;
+	}
+
+	if (!dst->bits)
+		container_make_bitmap(dst);
+	if (src->bits)
+		for (w = 0; w < BITMAP_WORDS; w++)
+			dst->bits[w] |= src->bits[w];
+	else
+		array_to_bits(src->array, src->cardinality, dst->bits);
+
+	/* two arrays with many common values may still fit in an array */
+	container_set_bits(dst, dst->bits);
+}
+
+/*
+ * Combine two containers with the same key into out, whose payload is newly
+ * allocated.  out->cardinality may be zero.
+ */
+static void
+container_op(BitmapOp op, const Container *a, const Container *b,
+			 Container *out)
+{
+	uint64	   *abits = a->bits;
+	uint64	   *bbits = b->bits;
+	uint64	   *bits;
+	int			w;
+
+	out->key = a->key;
+
+	if (!a->bits && !b->bits)
+	{
+		uint16		buf[2 * BITMAP_ARRAY_MAX];
+		int			n;
+
+		n = array_op(op, a->array, a->cardinality,
+					 b->array, b->cardinality, buf);
+		if (n > BITMAP_ARRAY_MAX)
+		{
+			bits = palloc0(BITMAP_WORDS * sizeof(uint64));
+			array_to_bits(buf, n, bits);
+			container_set_bits(out, bits);
+		}
+		else
+		{
+			out->cardinality = n;
+			out->capacity = Max(n, 1);
+			out->array = palloc(out->capacity * sizeof(uint16));
+			out->bits = NULL;
+			memcpy(out->array, buf, n * sizeof(uint16));
+		}
+		return;
+	}
+
+	/* at least one bitmap: work on words, expanding the other if needed */
+	if (!abits)
+	{
+		abits = palloc0(BITMAP_WORDS * sizeof(uint64));
+		array_to_bits(a->array, a->cardinality, abits);
+	}
+	if (!bbits)
+	{
+		bbits = palloc0(BITMAP_WORDS * sizeof(uint64));
+		array_to_bits(b->array, b->cardinality, bbits);
+	}
+
+	bits = palloc(BITMAP_WORDS * sizeof(uint64));
+	switch (op)
+	{
+		case BITMAP_AND:
+			for (w = 0; w < BITMAP_WORDS; w++)
+				bits[w] = abits[w] & bbits[w];
+			break;
+		case BITMAP_OR:
+			for (w = 0; w < BITMAP_WORDS; w++)
+				bits[w] = abits[w] | bbits[w];
+			break;
+		case BITMAP_XOR:
+			for (w = 0; w < BITMAP_WORDS; w++)
+				bits[w] = abits[w] ^ bbits[w];
+			break;
+		case BITMAP_ANDNOT:
+			for (w = 0; w < BITMAP_WORDS; w++)
+				bits[w] = abits[w] & ~bbits[w];
+			break;
+	}
+	container_set_bits(out, bits);
+
+	if (abits != a->bits)
+		pfree(abits);
+	if (bbits != b->bits)
+		pfree(bbits);
+}
+
+
+/*
+ *		============
+ *		BITMAP STATE
+ *		============
+ */
+
+static void
+state_init(BitmapState *s)
+{
+	s->n = 0;
+	s->capacity = 0;
+	s->c = NULL;
+}
+
+/* Make room for a container at pos, and return it zeroed */
+static Container *
+state_insert(BitmapState *s, int pos, uint16 key)
+{
+	if (s->n == s->capacity)
+	{
+		s->capacity = Max(s->capacity * 2, 8);
+		s->c = s->c ? repalloc(s->c, s->capacity * sizeof(Container))
+			: palloc(s->capacity * sizeof(Container));
+	}
+	memmove(&s->c[pos + 1], &s->c[pos], (s->n - pos) * sizeof(Container));
+	s->n++;
+
+	memset(&s->c[pos], 0, sizeof(Container));
+	s->c[pos].key = key;
+	return &s->c[pos];
+}
+
+/* Index of the container for key, or where it would go as -(pos + 1) */
+static int
+state_search(const BitmapState *s, uint16 key)
+{
+	int			lo = 0;
+	int			hi = s->n;
+
+	while (lo < hi)
+	{
+		int			mid = lo + (hi - lo) / 2;
+
+		if (s->c[mid].key < key)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	if (lo < s->n && s->c[lo].key == key)
+		return lo;
+	return -(lo + 1);
+}
+
+static void
+state_add(BitmapState *s, uint32 value)
+{
+	uint16		key = value >> 16;
+	Container  *c;
+
+	/* sorted input hits the last container */
+	if (s->n > 0 && s->c[s->n - 1].key == key)
+		c = &s->c[s->n - 1];
+	else
+	{
+		int			pos = state_search(s, key);
+
+		c = pos >= 0 ? &s->c[pos] : state_insert(s, -pos - 1, key);
+	}
+
+	container_add(c, (uint16) value);
+}
+
+/* Add the values of src to dst, which must own its containers */
+static void
+state_or_into(BitmapState *dst, const BitmapState *src)
+{
+	int			i;
+
+	for (i = 0; i < src->n; i++)
+	{
+		int			pos = state_search(dst, src->c[i].key);
+
+		if (pos >= 0)
+			container_or_into(&dst->c[pos], &src->c[i]);
+		else
+			container_copy(state_insert(dst, -pos - 1, src->c[i].key),
+						   &src->c[i]);
+	}
+}
+
+/* Combine a and b into out, which may point into either input */
+static void
+state_op(BitmapOp op, const BitmapState *a, const BitmapState *b,
+		 BitmapState *out)
+{
+	int			i = 0;
+	int			j = 0;
+
+	while (i < a->n || j < b->n)
+	{
+		if (j >= b->n || (i < a->n && a->c[i].key < b->c[j].key))
+		{
+			if (op != BITMAP_AND)
+				*state_insert(out, out->n, a->c[i].key) = a->c[i];
+			i++;
+		}
+		else if (i >= a->n || b->c[j].key < a->c[i].key)
+		{
+			if (op == BITMAP_OR || op == BITMAP_XOR)
+				*state_insert(out, out->n, b->c[j].key) = b->c[j];
+			j++;
+		}
+		else
+		{
+			Container	c;
+
+			container_op(op, &a->c[i], &b->c[j], &c);
+			if (c.cardinality > 0)
+				*state_insert(out, out->n, c.key) = c;
+			i++;
+			j++;
+		}
+	}
+}
+
+/* Point a state at the containers of a stored bitmap, or copy them */
+static void
+state_from_bitmap(BitmapState *s, const Uint4Bitmap *bm, bool copy)
+{
+	const Uint4BitmapContainer *bc = UINT4BITMAP_CONTAINERS(bm);
+	uint32		i;
+
+	state_init(s);
+	s->capacity = Max(bm->ncontainers, 1);
+	s->c = palloc0(s->capacity * sizeof(Container));
+	s->n = bm->ncontainers;
+
+	for (i = 0; i < bm->ncontainers; i++)
+	{
+		Container	view;
+
+		view.key = bc[i].key;
+		view.cardinality = bc[i].cardinality;
+		view.capacity = 0;
+		view.array = NULL;
+		view.bits = NULL;
+		if (bc[i].cardinality > BITMAP_ARRAY_MAX)
+			view.bits = (uint64 *) UINT4BITMAP_PAYLOAD(bm, &bc[i]);
+		else
+			view.array = (uint16 *) UINT4BITMAP_PAYLOAD(bm, &bc[i]);
+
+		if (copy)
+			container_copy(&s->c[i], &view);
+		else
+			s->c[i] = view;
+	}
+}
+
+static Uint4Bitmap *
+state_to_bitmap(const BitmapState *s)
+{
+	Uint4Bitmap *result;
+	Uint4BitmapContainer *bc;
+	Size		size;
+	int			i;
+
+	/* bitmap payloads are 8-byte aligned, array payloads 2-byte aligned */
+	size = sizeof(Uint4Bitmap) + s->n * sizeof(Uint4BitmapContainer);
+	for (i = 0; i < s->n; i++)
+	{
+		Assert((s->c[i].bits != NULL) ==
+			   (s->c[i].cardinality > BITMAP_ARRAY_MAX));
+		if (s->c[i].bits)
+			size = TYPEALIGN(8, size) + BITMAP_WORDS * sizeof(uint64);
+		else
+			size += s->c[i].cardinality * sizeof(uint16);
+	}
+
+	result = palloc0(size);
+	SET_VARSIZE(result, size);
+	result->ncontainers = s->n;
+
+	bc = (Uint4BitmapContainer *) UINT4BITMAP_CONTAINERS(result);
+	size = sizeof(Uint4Bitmap) + s->n * sizeof(Uint4BitmapContainer);
+	for (i = 0; i < s->n; i++)
+	{
+		Size		len;
+
+		if (s->c[i].bits)
+			size = TYPEALIGN(8, size);
+		bc[i].key = s->c[i].key;
+		bc[i].cardinality = s->c[i].cardinality;
+		bc[i].offset = size;
+
+		if (s->c[i].bits)
+		{
+			len = BITMAP_WORDS * sizeof(uint64);
+			memcpy((char *) result + size, s->c[i].bits, len);
+		}
+		else
+		{
+			len = s->c[i].cardinality * sizeof(uint16);
+			memcpy((char *) result + size, s->c[i].array, len);
+		}
+		size += len;
+	}
+
+	return result;
+}
+
+
+/*
+ *		==================
+ *		STORED FORM ACCESS
+ *		==================
+ */
+
+typedef struct
+{
+	const Uint4Bitmap *bm;
+	uint32		container;		/* current container */
+	int			pos;			/* next array index, or next bit to test */
+} BitmapIterator;
+
+static void
+bitmap_iterator_init(BitmapIterator *it, const Uint4Bitmap *bm)
+{
+	it->bm = bm;
+	it->container = 0;
+	it->pos = 0;
+}
+
+static bool
+bitmap_iterator_next(BitmapIterator *it, uint32 *value)
+{
+	const Uint4BitmapContainer *bc = UINT4BITMAP_CONTAINERS(it->bm);
+
+	while (it->container < it->bm->ncontainers)
+	{
+		const Uint4BitmapContainer *c = &bc[it->container];
+
+		if (c->cardinality <= BITMAP_ARRAY_MAX)
+		{
+			const uint16 *array = UINT4BITMAP_PAYLOAD(it->bm, c);
+
+			if (it->pos < c->cardinality)
+			{
+				*value = ((uint32) c->key << 16) | array[it->pos++];
+				return true;
+			}
+		}
+		else if (it->pos < 65536)
+		{
+			const uint64 *bits = UINT4BITMAP_PAYLOAD(it->bm, c);
+			int			w = it->pos >> 6;
+			uint64		word = bits[w] & (~UINT64CONST(0) << (it->pos & 63));
+
+			while (word == 0 && ++w < BITMAP_WORDS)
+				word = bits[w];
+			if (word != 0)
+			{
+				int			low = w * 64 + pg_rightmost_one_pos64(word);
+
+				it->pos = low + 1;
+				*value = ((uint32) c->key << 16) | low;
+				return true;
+			}
+		}
+
+		it->container++;
+		it->pos = 0;
+	}
+
+	return false;
+}
+
+static bool
+bitmap_contains(const Uint4Bitmap *bm, uint32 value)
+{
+	const Uint4BitmapContainer *bc = UINT4BITMAP_CONTAINERS(bm);
+	uint16		key = value >> 16;
+	uint16		low = (uint16) value;
+	int			lo = 0;
+	int			hi = bm->ncontainers;
+
+	while (lo < hi)
+	{
+		int			mid = lo + (hi - lo) / 2;
+
+		if (bc[mid].key < key)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	if (lo == bm->ncontainers || bc[lo].key != key)
+		return false;
+
+	if (bc[lo].cardinality > BITMAP_ARRAY_MAX)
+	{
+		const uint64 *bits = UINT4BITMAP_PAYLOAD(bm, &bc[lo]);
+
+		return (bits[low >> 6] >> (low & 63)) & 1;
+	}
+
+	return array_search(UINT4BITMAP_PAYLOAD(bm, &bc[lo]),
+						bc[lo].cardinality, low) >= 0;
+}
+
+
+/*
+ *		======================
+ *		SQL-CALLABLE FUNCTIONS
+ *		======================
+ */
+
+DECLARE(uint4bitmap_in)
+Datum
+uint4bitmap_in(PG_FUNCTION_ARGS)
+{
+	BitmapState s;
+	uint32	   *values;
+	int			n;
+	int			i;
+
+	values = uint4_list_in(PG_GETARG_CSTRING(0), "uint4bitmap", &n);
+
+	state_init(&s);
+	for (i = 0; i < n; i++)
+		state_add(&s, values[i]);
+
+	PG_RETURN_POINTER(state_to_bitmap(&s));
+}
+
+DECLARE(uint4bitmap_out)
+Datum
+uint4bitmap_out(PG_FUNCTION_ARGS)
+{
+	Uint4Bitmap *bm = PG_GETARG_UINT4BITMAP_P(0);
+	BitmapIterator it;
+	StringInfoData buf;
+	uint32		value;
+
+	initStringInfo(&buf);
+	appendStringInfoChar(&buf, '{');
+	bitmap_iterator_init(&it, bm);
+	while (bitmap_iterator_next(&it, &value))
+	{
+		enlargeStringInfo(&buf, MAXUINT4LEN + 1);
+		if (buf.len > 1)
+			buf.data[buf.len++] = ',';
+		buf.len += pg_u4toa(value, buf.data + buf.len);
+	}
+	appendStringInfoChar(&buf, '}');
+
+	PG_RETURN_CSTRING(buf.data);
+}
+
+DECLARE(uint4bitmap_cardinality)
+Datum
+uint4bitmap_cardinality(PG_FUNCTION_ARGS)
+{
+	Uint4Bitmap *bm = PG_GETARG_UINT4BITMAP_P(0);
+	const Uint4BitmapContainer *bc = UINT4BITMAP_CONTAINERS(bm);
+	int64		result = 0;
+	uint32		i;
+
+	for (i = 0; i < bm->ncontainers; i++)
+		result += bc[i].cardinality;
+
+	PG_RETURN_INT64(result);
+}
+
+DECLARE(uint4bitmap_contains)
+Datum
+uint4bitmap_contains(PG_FUNCTION_ARGS)
+{
+	Uint4Bitmap *bm = PG_GETARG_UINT4BITMAP_P(0);
+
+	PG_RETURN_BOOL(bitmap_contains(bm, PG_GETARG_UINT32(1)));
+}
+
+DECLARE(uint4bitmap_contained)
+Datum
+uint4bitmap_contained(PG_FUNCTION_ARGS)
+{
+	Uint4Bitmap *bm = PG_GETARG_UINT4BITMAP_P(1);
+
+	PG_RETURN_BOOL(bitmap_contains(bm, PG_GETARG_UINT32(0)));
+}
+
+static Datum
+uint4bitmap_op(FunctionCallInfo fcinfo, BitmapOp op)
+{
+	BitmapState a;
+	BitmapState b;
+	BitmapState result;
+
+	state_from_bitmap(&a, PG_GETARG_UINT4BITMAP_P(0), false);
+	state_from_bitmap(&b, PG_GETARG_UINT4BITMAP_P(1), false);
+	state_init(&result);
+	state_op(op, &a, &b, &result);
+
+	PG_RETURN_POINTER(state_to_bitmap(&result));
+}
+
+DECLARE(uint4bitmap_and)
+Datum
+uint4bitmap_and(PG_FUNCTION_ARGS)
+{
+	return uint4bitmap_op(fcinfo, BITMAP_AND);
+}
+
+DECLARE(uint4bitmap_or)
+Datum
+uint4bitmap_or(PG_FUNCTION_ARGS)
+{
+	return uint4bitmap_op(fcinfo, BITMAP_OR);
+}
+
+DECLARE(uint4bitmap_xor)
+Datum
+uint4bitmap_xor(PG_FUNCTION_ARGS)
+{
+	return uint4bitmap_op(fcinfo, BITMAP_XOR);
+}
+
+DECLARE(uint4bitmap_andnot)
+Datum
+uint4bitmap_andnot(PG_FUNCTION_ARGS)
+{
+	return uint4bitmap_op(fcinfo, BITMAP_ANDNOT);
+}
+
+/* The values of a bitmap, in increasing order */
+DECLARE(uint4bitmap_values)
+Datum
+uint4bitmap_values(PG_FUNCTION_ARGS)
+{
+	FuncCallContext *funcctx;
+	BitmapIterator *it;
+	uint32		value;
+
+	if (SRF_IS_FIRSTCALL())
+	{
+		MemoryContext oldcontext;
+
+		funcctx = SRF_FIRSTCALL_INIT();
+		oldcontext = MemoryContextSwitchTo(funcctx->multi_call_memory_ctx);
+
+		it = (BitmapIterator *) palloc(sizeof(BitmapIterator));
+		bitmap_iterator_init(it, PG_GETARG_UINT4BITMAP_P(0));
+		funcctx->user_fctx = it;
+
+		MemoryContextSwitchTo(oldcontext);
+	}
+
+	funcctx = SRF_PERCALL_SETUP();
+	it = (BitmapIterator *) funcctx->user_fctx;
+
+	if (bitmap_iterator_next(it, &value))
+		SRF_RETURN_NEXT(funcctx, UInt32GetDatum(value));
+
+	SRF_RETURN_DONE(funcctx);
+}
+
+
+/*
+ *		==========
+ *		AGGREGATES
+ *		==========
+ *
+ * uint4bitmap_agg(uint4) and uint4bitmap_or_agg(uint4bitmap) share the
+ * state, final, combine and serialization functions.  The transition
+ * functions aren't strict, so that they create the state on the first
+ * non-NULL input; until then the state stays NULL, and so does the result
+ * over only NULLs.
+ */
+
+static MemoryContext
+bitmap_agg_context(FunctionCallInfo fcinfo)
+{
+	MemoryContext agg_context;
+
+	if (!AggCheckCallContext(fcinfo, &agg_context))
+		elog(ERROR, "aggregate function called in non-aggregate context");
+
+	return agg_context;
+}
+
+static BitmapState *
+bitmap_agg_state(FunctionCallInfo fcinfo, MemoryContext agg_context)
+{
+	BitmapState *state;
+
+	if (!PG_ARGISNULL(0))
+		return (BitmapState *) PG_GETARG_POINTER(0);
+
+	state = (BitmapState *) MemoryContextAlloc(agg_context,
+											   sizeof(BitmapState));
+	state_init(state);
+	return state;
+}
+
+DECLARE(uint4bitmap_agg_trans)
+Datum
+uint4bitmap_agg_trans(PG_FUNCTION_ARGS)
+{
+	MemoryContext agg_context = bitmap_agg_context(fcinfo);
+	MemoryContext oldcontext;
+	BitmapState *state;
+
+	if (PG_ARGISNULL(1))
+	{
+		if (PG_ARGISNULL(0))
+			PG_RETURN_NULL();
+		PG_RETURN_DATUM(PG_GETARG_DATUM(0));
+	}
+
+	oldcontext = MemoryContextSwitchTo(agg_context);
+	state = bitmap_agg_state(fcinfo, agg_context);
+	state_add(state, PG_GETARG_UINT32(1));
+	MemoryContextSwitchTo(oldcontext);
+
+	PG_RETURN_POINTER(state);
+}
+
+DECLARE(uint4bitmap_or_trans)
+Datum
+uint4bitmap_or_trans(PG_FUNCTION_ARGS)
+{
+	MemoryContext agg_context = bitmap_agg_context(fcinfo);
+	MemoryContext oldcontext;
+	BitmapState *state;
+	BitmapState input;
+
+	if (PG_ARGISNULL(1))
+	{
+		if (PG_ARGISNULL(0))
+			PG_RETURN_NULL();
+		PG_RETURN_DATUM(PG_GETARG_DATUM(0));
+	}
+
+	state_from_bitmap(&input, PG_GETARG_UINT4BITMAP_P(1), false);
+
+	oldcontext = MemoryContextSwitchTo(agg_context);
+	state = bitmap_agg_state(fcinfo, agg_context);
+	state_or_into(state, &input);
+	MemoryContextSwitchTo(oldcontext);
+
+	PG_RETURN_POINTER(state);
+}
+
+DECLARE(uint4bitmap_agg_combine)
+Datum
+uint4bitmap_agg_combine(PG_FUNCTION_ARGS)
+{
+	MemoryContext agg_context = bitmap_agg_context(fcinfo);
+	MemoryContext oldcontext;
+	BitmapState *state1;
+	BitmapState *state2;
+
+	state2 = PG_ARGISNULL(1) ? NULL : (BitmapState *) PG_GETARG_POINTER(1);
+	if (state2 == NULL)
+	{
+		if (PG_ARGISNULL(0))
+			PG_RETURN_NULL();
+		PG_RETURN_DATUM(PG_GETARG_DATUM(0));
+	}
+
+	oldcontext = MemoryContextSwitchTo(agg_context);
+	state1 = bitmap_agg_state(fcinfo, agg_context);
+	state_or_into(state1, state2);
+	MemoryContextSwitchTo(oldcontext);
+
+	PG_RETURN_POINTER(state1);
+}
+
+DECLARE(uint4bitmap_agg_serialize)
+Datum
+uint4bitmap_agg_serialize(PG_FUNCTION_ARGS)
+{
+	/* Ensure we disallow calling when not in aggregate context */
+	bitmap_agg_context(fcinfo);
+
+	PG_RETURN_BYTEA_P(state_to_bitmap((BitmapState *) PG_GETARG_POINTER(0)));
+}
+
+DECLARE(uint4bitmap_agg_deserialize)
+Datum
+uint4bitmap_agg_deserialize(PG_FUNCTION_ARGS)
+{
+	MemoryContext agg_context = bitmap_agg_context(fcinfo);
+	MemoryContext oldcontext;
+	Uint4Bitmap *bm = PG_GETARG_UINT4BITMAP_P(0);
+	BitmapState *state;
+
+	oldcontext = MemoryContextSwitchTo(agg_context);
+	state = (BitmapState *) palloc(sizeof(BitmapState));
+	state_from_bitmap(state, bm, true);
+	MemoryContextSwitchTo(oldcontext);
+
+	PG_RETURN_POINTER(state);
+}
+
+DECLARE(uint4bitmap_agg_final)
+Datum
+uint4bitmap_agg_final(PG_FUNCTION_ARGS)
+{
+	if (PG_ARGISNULL(0))
+		PG_RETURN_NULL();
+
+	PG_RETURN_POINTER(state_to_bitmap((BitmapState *) PG_GETARG_POINTER(0)));
+}
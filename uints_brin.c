@@ -0,0 +1,64 @@
+/*-------------------------------------------------------------------------
+ *
+ * uints_brin.c
+ *	  BRIN support for unsigned integer types
+ *
+ *	  The minmax, minmax-multi and bloom operator classes use the core BRIN
+ *	  support procedures, which find the comparison operators through the
+ *	  operator family.  Only the minmax-multi distance functions, used to
+ *	  decide which ranges to merge, are type-specific.
+ *
+ * Portions Copyright (c) 1996-2013, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include "fmgr.h"
+
+#include "declare.h"
+#include "uints_fmgr.h"
+
+/*
+ * Distance between two range boundaries, a <= b.  Computed in double, like
+ * the core integer versions; only the relative sizes matter.
+ */
+
+DECLARE(uint2_minmax_multi_distance)
+Datum
+uint2_minmax_multi_distance(PG_FUNCTION_ARGS)
+{
+	uint16		a = PG_GETARG_UINT16(0);
+	uint16		b = PG_GETARG_UINT16(1);
+
+	Assert(a <= b);
+
+	PG_RETURN_FLOAT8((double) b - (double) a);
+}
+
+DECLARE(uint4_minmax_multi_distance)
+Datum
+uint4_minmax_multi_distance(PG_FUNCTION_ARGS)
+{
+	uint32		a = PG_GETARG_UINT32(0);
+	uint32		b = PG_GETARG_UINT32(1);
+
+	Assert(a <= b);
+
+	PG_RETURN_FLOAT8((double) b - (double) a);
+}
+
+DECLARE(uint8_minmax_multi_distance)
+Datum
+uint8_minmax_multi_distance(PG_FUNCTION_ARGS)
+{
+	uint64		a = PG_GETARG_UINT64(0);
+	uint64		b = PG_GETARG_UINT64(1);
+
+	Assert(a <= b);
+
+	/* subtract first, converting both could lose the difference */
+	PG_RETURN_FLOAT8((double) (b - a));
+}
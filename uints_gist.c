@@ -0,0 +1,543 @@
+/*-------------------------------------------------------------------------
+ *
+ * uints_gist.c
+ *	  GiST support for unsigned integer types
+ *
+ *	  Modelled on contrib/btree_gist: every index entry holds the smallest
+ *	  and largest value below it, so the tree behaves like a btree and also
+ *	  supports exclusion constraints and nearest-neighbour ("<->") ordering.
+ *	  All widths share one 16-byte key of two uint64 bounds, which lets the
+ *	  union, penalty, picksplit and same functions be shared too.
+ *
+ *	  Queries may also compare against int2, int4 or int8 values.  A
+ *	  negative query value lies below every key.
+ *
+ * Portions Copyright (c) 1996-2013, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include <float.h>
+
+#include "access/gist.h"
+#include "access/stratnum.h"
+#include "catalog/pg_type.h"
+#include "fmgr.h"
+#include "utils/rel.h"
+
+#include "declare.h"
+#include "uints_fmgr.h"
+
+/* Strategy number of "<>", as in btree_gist */
+#define UintGistNotEqualStrategyNumber	6
+
+typedef struct
+{
+	uint64		lower;
+	uint64		upper;
+} UintGistKey;
+
+/* A query value, which is negative only if it came from a signed type */
+typedef struct
+{
+	bool		neg;
+	uint64		val;			/* absolute value */
+} UintGistQuery;
+
+/*
+ *		==============
+ *		KEY TYPE I/O
+ *		==============
+ */
+
+DECLARE(uintgistkey_in)
+Datum
+uintgistkey_in(PG_FUNCTION_ARGS)
+{
+	ereport(ERROR,
+			(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+			 errmsg("cannot accept a value of type %s", "uintgistkey")));
+
+	PG_RETURN_VOID();			/* keep compiler quiet */
+}
+
+DECLARE(uintgistkey_out)
+Datum
+uintgistkey_out(PG_FUNCTION_ARGS)
+{
+	ereport(ERROR,
+			(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+			 errmsg("cannot display a value of type %s", "uintgistkey")));
+
+	PG_RETURN_VOID();			/* keep compiler quiet */
+}
+
+/*
+ *		=================
+ *		WIDTH-AWARE PARTS
+ *		=================
+ */
+
+static inline
+uint64
+uint_gist_get(Datum value, int width)
+{
+	switch (width)
+	{
+		case 2:
+			return DatumGetUInt16(value);
+		case 4:
+			return DatumGetUInt32(value);
+		default:
+			return DatumGetUInt64(value);
+	}
+}
+
+static inline
+Datum
+uint_gist_make(uint64 value, int width)
+{
+	switch (width)
+	{
+		case 2:
+			return UInt16GetDatum((uint16) value);
+		case 4:
+			return UInt32GetDatum((uint32) value);
+		default:
+			return UInt64GetDatum(value);
+	}
+}
+
+/*
+ * Decode a query argument.  Its type is the right-hand input of the
+ * operator, which is either the indexed type or a signed integer type.
+ */
+static UintGistQuery
+uint_gist_query(Datum value, Oid subtype, int width)
+{
+	UintGistQuery query;
+	int64		sval;
+
+	switch (subtype)
+	{
+		case INT2OID:
+			sval = DatumGetInt16(value);
+			break;
+		case INT4OID:
+			sval = DatumGetInt32(value);
+			break;
+		case INT8OID:
+			sval = DatumGetInt64(value);
+			break;
+		default:
+			query.neg = false;
+			query.val = uint_gist_get(value, width);
+			return query;
+	}
+
+	query.neg = (sval < 0);
+	/* negate in unsigned arithmetic, so that INT64_MIN works too */
+	query.val = query.neg ? -(uint64) sval : (uint64) sval;
+	return query;
+}
+
+static Datum
+uint_gist_compress(GISTENTRY *entry, int width)
+{
+	GISTENTRY  *retval;
+	UintGistKey *key;
+	uint64		value;
+
+	if (!entry->leafkey)
+		return PointerGetDatum(entry);
+
+	value = uint_gist_get(entry->key, width);
+
+	key = (UintGistKey *) palloc(sizeof(UintGistKey));
+	key->lower = value;
+	key->upper = value;
+
+	retval = (GISTENTRY *) palloc(sizeof(GISTENTRY));
+	gistentryinit(*retval, PointerGetDatum(key),
+				  entry->rel, entry->page, entry->offset, false);
+
+	return PointerGetDatum(retval);
+}
+
+static Datum
+uint_gist_fetch(GISTENTRY *entry, int width)
+{
+	UintGistKey *key = (UintGistKey *) DatumGetPointer(entry->key);
+	GISTENTRY  *retval;
+
+	retval = (GISTENTRY *) palloc(sizeof(GISTENTRY));
+	gistentryinit(*retval, uint_gist_make(key->lower, width),
+				  entry->rel, entry->page, entry->offset, false);
+
+	return PointerGetDatum(retval);
+}
+
+/*
+ * Can any value in [key->lower, key->upper] satisfy "value op query"?  For
+ * a leaf key the two bounds are equal, and this is the exact answer.
+ */
+static bool
+uint_gist_consistent(UintGistKey *key, UintGistQuery *query,
+					 StrategyNumber strategy)
+{
+	uint64		v = query->val;
+
+	if (query->neg)
+	{
+		switch (strategy)
+		{
+			case BTLessStrategyNumber:
+			case BTLessEqualStrategyNumber:
+			case BTEqualStrategyNumber:
+				return false;
+			default:
+				return true;
+		}
+	}
+
+	switch (strategy)
+	{
+		case BTLessStrategyNumber:
+			return key->lower < v;
+		case BTLessEqualStrategyNumber:
+			return key->lower <= v;
+		case BTEqualStrategyNumber:
+			return key->lower <= v && v <= key->upper;
+		case BTGreaterEqualStrategyNumber:
+			return key->upper >= v;
+		case BTGreaterStrategyNumber:
+			return key->upper > v;
+		case UintGistNotEqualStrategyNumber:
+			return !(key->lower == v && key->upper == v);
+		default:
+			elog(ERROR, "unrecognized strategy number: %d", strategy);
+			return false;		/* keep compiler quiet */
+	}
+}
+
+/* Distance from the query to the nearest value in the key's range */
+static float8
+uint_gist_distance(UintGistKey *key, UintGistQuery *query)
+{
+	if (query->neg)
+		return (float8) key->lower + (float8) query->val;
+	else if (query->val < key->lower)
+		return (float8) (key->lower - query->val);
+	else if (query->val > key->upper)
+		return (float8) (query->val - key->upper);
+	else
+		return 0.0;
+}
+
+/*
+ * The type-specific entry points only supply the width.  The
+ * consistent and distance results are exact, so no recheck is needed.
+ */
+#define UINT_GIST_FUNCS(type, width) \
+DECLARE(type##_gist_compress) \
+Datum \
+type##_gist_compress(PG_FUNCTION_ARGS) \
+{ \
+	GISTENTRY  *entry = (GISTENTRY *) PG_GETARG_POINTER(0); \
+	\
+	return uint_gist_compress(entry, width); \
+} \
+\
+DECLARE(type##_gist_fetch) \
+Datum \
+type##_gist_fetch(PG_FUNCTION_ARGS) \
+{ \
+	GISTENTRY  *entry = (GISTENTRY *) PG_GETARG_POINTER(0); \
+	\
+	return uint_gist_fetch(entry, width); \
+} \
+\
+DECLARE(type##_gist_consistent) \
+Datum \
+type##_gist_consistent(PG_FUNCTION_ARGS) \
+{ \
+	GISTENTRY  *entry = (GISTENTRY *) PG_GETARG_POINTER(0); \
+	StrategyNumber strategy = (StrategyNumber) PG_GETARG_UINT16(2); \
+	Oid			subtype = PG_GETARG_OID(3); \
+	bool	   *recheck = (bool *) PG_GETARG_POINTER(4); \
+	UintGistQuery query; \
+	\
+	query = uint_gist_query(PG_GETARG_DATUM(1), subtype, width); \
+	*recheck = false; \
+	\
+	PG_RETURN_BOOL(uint_gist_consistent((UintGistKey *) \
+										DatumGetPointer(entry->key), \
+										&query, strategy)); \
+} \
+\
+DECLARE(type##_gist_distance) \
+Datum \
+type##_gist_distance(PG_FUNCTION_ARGS) \
+{ \
+	GISTENTRY  *entry = (GISTENTRY *) PG_GETARG_POINTER(0); \
+	Oid			subtype = PG_GETARG_OID(3); \
+	bool	   *recheck = (bool *) PG_GETARG_POINTER(4); \
+	UintGistQuery query; \
+	\
+	query = uint_gist_query(PG_GETARG_DATUM(1), subtype, width); \
+	*recheck = false; \
+	\
+	PG_RETURN_FLOAT8(uint_gist_distance((UintGistKey *) \
+										DatumGetPointer(entry->key), \
+										&query)); \
+}
+
+UINT_GIST_FUNCS(uint2, 2)
+UINT_GIST_FUNCS(uint4, 4)
+UINT_GIST_FUNCS(uint8, 8)
+
+/*
+ *		=========================
+ *		WIDTH-INDEPENDENT METHODS
+ *		=========================
+ */
+
+DECLARE(uint_gist_union)
+Datum
+uint_gist_union(PG_FUNCTION_ARGS)
+{
+	GistEntryVector *entryvec = (GistEntryVector *) PG_GETARG_POINTER(0);
+	int		   *size = (int *) PG_GETARG_POINTER(1);
+	UintGistKey *result;
+	int			i;
+
+	result = (UintGistKey *) palloc(sizeof(UintGistKey));
+	*result = *(UintGistKey *) DatumGetPointer(entryvec->vector[0].key);
+
+	for (i = 1; i < entryvec->n; i++)
+	{
+		UintGistKey *cur = (UintGistKey *) DatumGetPointer(entryvec->vector[i].key);
+
+		if (cur->lower < result->lower)
+			result->lower = cur->lower;
+		if (cur->upper > result->upper)
+			result->upper = cur->upper;
+	}
+
+	*size = sizeof(UintGistKey);
+	PG_RETURN_POINTER(result);
+}
+
+/*
+ * The penalty is how far the original range must stretch to take in the
+ * new one, relative to its current width, as btree_gist computes it.
+ */
+DECLARE(uint_gist_penalty)
+Datum
+uint_gist_penalty(PG_FUNCTION_ARGS)
+{
+	GISTENTRY  *origentry = (GISTENTRY *) PG_GETARG_POINTER(0);
+	GISTENTRY  *newentry = (GISTENTRY *) PG_GETARG_POINTER(1);
+	float	   *result = (float *) PG_GETARG_POINTER(2);
+	UintGistKey *orig = (UintGistKey *) DatumGetPointer(origentry->key);
+	UintGistKey *newkey = (UintGistKey *) DatumGetPointer(newentry->key);
+	double		growth = 0.0;
+
+	if (newkey->upper > orig->upper)
+		growth += (double) (newkey->upper - orig->upper);
+	if (newkey->lower < orig->lower)
+		growth += (double) (orig->lower - newkey->lower);
+
+	*result = 0.0;
+	if (growth > 0.0)
+	{
+		*result += FLT_MIN;
+		*result += (float) (growth /
+							(growth + (double) (orig->upper - orig->lower)));
+		*result *= (FLT_MAX / (origentry->rel->rd_att->natts + 1));
+	}
+
+	PG_RETURN_POINTER(result);
+}
+
+typedef struct
+{
+	OffsetNumber offset;
+	UintGistKey *key;
+} UintGistSplitItem;
+
+static int
+uint_gist_split_cmp(const void *a, const void *b)
+{
+	const UintGistKey *ka = ((const UintGistSplitItem *) a)->key;
+	const UintGistKey *kb = ((const UintGistSplitItem *) b)->key;
+
+	if (ka->lower != kb->lower)
+		return (ka->lower > kb->lower) ? 1 : -1;
+	if (ka->upper != kb->upper)
+		return (ka->upper > kb->upper) ? 1 : -1;
+	return 0;
+}
+
+static void
+uint_gist_extend(UintGistKey **union_key, UintGistKey *key)
+{
+	if (*union_key == NULL)
+	{
+		*union_key = (UintGistKey *) palloc(sizeof(UintGistKey));
+		**union_key = *key;
+		return;
+	}
+
+	if (key->lower < (*union_key)->lower)
+		(*union_key)->lower = key->lower;
+	if (key->upper > (*union_key)->upper)
+		(*union_key)->upper = key->upper;
+}
+
+/*
+ * Sort the entries by range and put the first half on the left page: the
+ * entries are one-dimensional, so that gives two tight, disjoint-ish halves.
+ */
+DECLARE(uint_gist_picksplit)
+Datum
+uint_gist_picksplit(PG_FUNCTION_ARGS)
+{
+	GistEntryVector *entryvec = (GistEntryVector *) PG_GETARG_POINTER(0);
+	GIST_SPLITVEC *v = (GIST_SPLITVEC *) PG_GETARG_POINTER(1);
+	OffsetNumber maxoff = entryvec->n - 1;
+	int			nitems = maxoff;
+	UintGistSplitItem *items;
+	UintGistKey *left = NULL;
+	UintGistKey *right = NULL;
+	OffsetNumber i;
+	int			j;
+
+	items = (UintGistSplitItem *) palloc(sizeof(UintGistSplitItem) * nitems);
+	for (i = FirstOffsetNumber; i <= maxoff; i = OffsetNumberNext(i))
+	{
+		items[i - 1].offset = i;
+		items[i - 1].key = (UintGistKey *) DatumGetPointer(entryvec->vector[i].key);
+	}
+
+	qsort(items, nitems, sizeof(UintGistSplitItem), uint_gist_split_cmp);
+
+	v->spl_left = (OffsetNumber *) palloc(sizeof(OffsetNumber) * nitems);
+	v->spl_right = (OffsetNumber *) palloc(sizeof(OffsetNumber) * nitems);
+	v->spl_nleft = 0;
+	v->spl_nright = 0;
+
+	for (j = 0; j < nitems; j++)
+	{
+		if (j < nitems / 2)
+		{
+			v->spl_left[v->spl_nleft++] = items[j].offset;
+			uint_gist_extend(&left, items[j].key);
+		}
+		else
+		{
+			v->spl_right[v->spl_nright++] = items[j].offset;
+			uint_gist_extend(&right, items[j].key);
+		}
+	}
+
+	v->spl_ldatum = PointerGetDatum(left);
+	v->spl_rdatum = PointerGetDatum(right);
+
+	PG_RETURN_POINTER(v);
+}
+
+DECLARE(uint_gist_same)
+Datum
+uint_gist_same(PG_FUNCTION_ARGS)
+{
+	UintGistKey *a = (UintGistKey *) PG_GETARG_POINTER(0);
+	UintGistKey *b = (UintGistKey *) PG_GETARG_POINTER(1);
+	bool	   *result = (bool *) PG_GETARG_POINTER(2);
+
+	*result = (a->lower == b->lower && a->upper == b->upper);
+	PG_RETURN_POINTER(result);
+}
+
+/*
+ *		==================
+ *		DISTANCE OPERATORS
+ *		==================
+ */
+
+DECLARE(uint2_dist)
+Datum
+uint2_dist(PG_FUNCTION_ARGS)
+{
+	uint16		arg1 = PG_GETARG_UINT16(0);
+	uint16		arg2 = PG_GETARG_UINT16(1);
+
+	PG_RETURN_UINT16(arg1 > arg2 ? arg1 - arg2 : arg2 - arg1);
+}
+
+DECLARE(uint4_dist)
+Datum
+uint4_dist(PG_FUNCTION_ARGS)
+{
+	uint32		arg1 = PG_GETARG_UINT32(0);
+	uint32		arg2 = PG_GETARG_UINT32(1);
+
+	PG_RETURN_UINT32(arg1 > arg2 ? arg1 - arg2 : arg2 - arg1);
+}
+
+DECLARE(uint8_dist)
+Datum
+uint8_dist(PG_FUNCTION_ARGS)
+{
+	uint64		arg1 = PG_GETARG_UINT64(0);
+	uint64		arg2 = PG_GETARG_UINT64(1);
+
+	PG_RETURN_UINT64(arg1 > arg2 ? arg1 - arg2 : arg2 - arg1);
+}
+
+/*
+ * Distance to a signed value, as uint8.  This is what "col <-> 12345"
+ * resolves to, through the implicit int4 -> int8 cast.
+ */
+static inline
+uint64
+uint_int8_dist(uint64 arg1, int64 arg2)
+{
+	uint64		mag;
+
+	if (arg2 >= 0)
+	{
+		mag = (uint64) arg2;
+		return arg1 > mag ? arg1 - mag : mag - arg1;
+	}
+
+	mag = -(uint64) arg2;
+	if (arg1 > PG_UINT64_MAX - mag)
+		report_out_of_range();
+
+	return arg1 + mag;
+}
+
+DECLARE(uint2int8_dist)
+Datum
+uint2int8_dist(PG_FUNCTION_ARGS)
+{
+	PG_RETURN_UINT64(uint_int8_dist(PG_GETARG_UINT16(0), PG_GETARG_INT64(1)));
+}
+
+DECLARE(uint4int8_dist)
+Datum
+uint4int8_dist(PG_FUNCTION_ARGS)
+{
+	PG_RETURN_UINT64(uint_int8_dist(PG_GETARG_UINT32(0), PG_GETARG_INT64(1)));
+}
+
+DECLARE(uint8int8_dist)
+Datum
+uint8int8_dist(PG_FUNCTION_ARGS)
+{
+	PG_RETURN_UINT64(uint_int8_dist(PG_GETARG_UINT64(0), PG_GETARG_INT64(1)));
+}
@@ -0,0 +1,93 @@
+/*-------------------------------------------------------------------------
+ *
+ * uints_inrange.c
+ *	  in_range support for RANGE window frames over uint columns
+ *
+ *	  These are btree support function 3, which lets a window ordered by a
+ *	  uint column use "RANGE BETWEEN offset PRECEDING AND ...".  The offset
+ *	  may be any of the unsigned widths, or an int8 so that plain integer
+ *	  literals work.  All arithmetic is done in uint64, and a base plus or
+ *	  minus the offset that falls outside that range is decided without
+ *	  computing it.
+ *
+ * Portions Copyright (c) 1996-2013, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include "common/int.h"
+#include "fmgr.h"
+
+#include "declare.h"
+#include "uints_fmgr.h"
+
+/*
+ * Is val <= base - offset (sub and less), val >= base - offset (sub and not
+ * less), and so on, as the in_range support function contract asks
+ */
+static inline bool
+uint_in_range(uint64 val, uint64 base, uint64 offset, bool sub, bool less)
+{
+	uint64		bound;
+
+	if (sub)
+	{
+		/* the true bound is below zero, and so below val */
+		if (base < offset)
+			return !less;
+		bound = base - offset;
+	}
+	else
+	{
+		/* the true bound is above the uint64 range, and so above val */
+		if (pg_add_u64_overflow(base, offset, &bound))
+			return less;
+	}
+
+	if (less)
+		return val <= bound;
+	else
+		return val >= bound;
+}
+
+/* A signed offset, which must not be negative */
+static inline uint64
+uint_range_offset(int64 offset)
+{
+	if (offset < 0)
+		ereport(ERROR,
+				(errcode(ERRCODE_INVALID_PRECEDING_OR_FOLLOWING_SIZE),
+				 errmsg("invalid preceding or following size in window function")));
+	return (uint64) offset;
+}
+
+#define PG_GETARG_UINT16_OFFSET(n)	((uint64) PG_GETARG_UINT16(n))
+#define PG_GETARG_UINT32_OFFSET(n)	((uint64) PG_GETARG_UINT32(n))
+#define PG_GETARG_UINT64_OFFSET(n)	PG_GETARG_UINT64(n)
+#define PG_GETARG_INT64_OFFSET(n)	uint_range_offset(PG_GETARG_INT64(n))
+
+/*
+ * Define in_range for a column of type type, fetched with GETARG, and an
+ * offset of type otype, fetched with GETOFFSET.
+ */
+#define UINT_IN_RANGE(type, GETARG, otype, GETOFFSET) \
+DECLARE(in_range_##type##_##otype) \
+Datum \
+in_range_##type##_##otype(PG_FUNCTION_ARGS) \
+{ \
+	PG_RETURN_BOOL(uint_in_range(GETARG(0), GETARG(1), GETOFFSET(2), \
+								 PG_GETARG_BOOL(3), PG_GETARG_BOOL(4))); \
+}
+
+#define UINT_IN_RANGE_ALL(type, GETARG) \
+UINT_IN_RANGE(type, GETARG, uint2, PG_GETARG_UINT16_OFFSET) \
+UINT_IN_RANGE(type, GETARG, uint4, PG_GETARG_UINT32_OFFSET) \
+UINT_IN_RANGE(type, GETARG, uint8, PG_GETARG_UINT64_OFFSET) \
+UINT_IN_RANGE(type, GETARG, int8, PG_GETARG_INT64_OFFSET)
+
+UINT_IN_RANGE_ALL(uint2, PG_GETARG_UINT16)
+UINT_IN_RANGE_ALL(uint4, PG_GETARG_UINT32)
+UINT_IN_RANGE_ALL(uint8, PG_GETARG_UINT64)
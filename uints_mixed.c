@@ -0,0 +1,159 @@
+/*-------------------------------------------------------------------------
+ *
+ * uints_mixed.c
+ *	  Comparisons between unsigned and signed integer types
+ *
+ *	  These compare by numeric value: a negative signed value is smaller than
+ *	  every unsigned value, and is never equal to one.  They let
+ *	  "uint4_col = 5" resolve to an indexable cross-type operator instead of
+ *	  failing or forcing a cast.
+ *
+ *	  uintv is also compared here with each fixed-width type, by decoding it
+ *	  to uint64.
+ *
+ * Portions Copyright (c) 1996-2013, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include "fmgr.h"
+
+#include "declare.h"
+#include "uints_fmgr.h"
+#include "uintv.h"
+
+/*
+ * Three-way comparison of an unsigned and a signed value
+ */
+static inline
+int
+uint_int_cmp(uint64 a, int64 b)
+{
+	if (b < 0 || a > (uint64) b)
+		return 1;
+	else if (a < (uint64) b)
+		return -1;
+	else
+		return 0;
+}
+
+/*
+ * Three-way comparison of two unsigned values
+ */
+static inline
+int
+uint_uint_cmp(uint64 a, uint64 b)
+{
+	if (a > b)
+		return 1;
+	else if (a < b)
+		return -1;
+	else
+		return 0;
+}
+
+/*
+ * Define the six comparison functions and the btree comparator for one
+ * pair of argument types.  CMP is an expression comparing argument 0 with
+ * argument 1.
+ */
+#define MIXED_CMP_FUNCS(prefix, CMP) \
+DECLARE(prefix##eq) \
+Datum \
+prefix##eq(PG_FUNCTION_ARGS) \
+{ \
+	PG_RETURN_BOOL((CMP) == 0); \
+} \
+\
+DECLARE(prefix##ne) \
+Datum \
+prefix##ne(PG_FUNCTION_ARGS) \
+{ \
+	PG_RETURN_BOOL((CMP) != 0); \
+} \
+\
+DECLARE(prefix##lt) \
+Datum \
+prefix##lt(PG_FUNCTION_ARGS) \
+{ \
+	PG_RETURN_BOOL((CMP) < 0); \
+} \
+\
+DECLARE(prefix##le) \
+Datum \
+prefix##le(PG_FUNCTION_ARGS) \
+{ \
+	PG_RETURN_BOOL((CMP) <= 0); \
+} \
+\
+DECLARE(prefix##gt) \
+Datum \
+prefix##gt(PG_FUNCTION_ARGS) \
+{ \
+	PG_RETURN_BOOL((CMP) > 0); \
+} \
+\
+DECLARE(prefix##ge) \
+Datum \
+prefix##ge(PG_FUNCTION_ARGS) \
+{ \
+	PG_RETURN_BOOL((CMP) >= 0); \
+} \
+\
+DECLARE(prefix##_cmp) \
+Datum \
+prefix##_cmp(PG_FUNCTION_ARGS) \
+{ \
+	PG_RETURN_INT32(CMP); \
+}
+
+/* unsigned op signed */
+#define UINT_INT_CMP(ugetarg, sgetarg) \
+	uint_int_cmp((uint64) ugetarg(0), (int64) sgetarg(1))
+
+/* signed op unsigned */
+#define INT_UINT_CMP(sgetarg, ugetarg) \
+	(-uint_int_cmp((uint64) ugetarg(1), (int64) sgetarg(0)))
+
+MIXED_CMP_FUNCS(uint2int2, UINT_INT_CMP(PG_GETARG_UINT16, PG_GETARG_INT16))
+MIXED_CMP_FUNCS(uint2int4, UINT_INT_CMP(PG_GETARG_UINT16, PG_GETARG_INT32))
+MIXED_CMP_FUNCS(uint2int8, UINT_INT_CMP(PG_GETARG_UINT16, PG_GETARG_INT64))
+MIXED_CMP_FUNCS(uint4int2, UINT_INT_CMP(PG_GETARG_UINT32, PG_GETARG_INT16))
+MIXED_CMP_FUNCS(uint4int4, UINT_INT_CMP(PG_GETARG_UINT32, PG_GETARG_INT32))
+MIXED_CMP_FUNCS(uint4int8, UINT_INT_CMP(PG_GETARG_UINT32, PG_GETARG_INT64))
+MIXED_CMP_FUNCS(uint8int2, UINT_INT_CMP(PG_GETARG_UINT64, PG_GETARG_INT16))
+MIXED_CMP_FUNCS(uint8int4, UINT_INT_CMP(PG_GETARG_UINT64, PG_GETARG_INT32))
+MIXED_CMP_FUNCS(uint8int8, UINT_INT_CMP(PG_GETARG_UINT64, PG_GETARG_INT64))
+
+MIXED_CMP_FUNCS(int2uint2, INT_UINT_CMP(PG_GETARG_INT16, PG_GETARG_UINT16))
+MIXED_CMP_FUNCS(int4uint2, INT_UINT_CMP(PG_GETARG_INT32, PG_GETARG_UINT16))
+MIXED_CMP_FUNCS(int8uint2, INT_UINT_CMP(PG_GETARG_INT64, PG_GETARG_UINT16))
+MIXED_CMP_FUNCS(int2uint4, INT_UINT_CMP(PG_GETARG_INT16, PG_GETARG_UINT32))
+MIXED_CMP_FUNCS(int4uint4, INT_UINT_CMP(PG_GETARG_INT32, PG_GETARG_UINT32))
+MIXED_CMP_FUNCS(int8uint4, INT_UINT_CMP(PG_GETARG_INT64, PG_GETARG_UINT32))
+MIXED_CMP_FUNCS(int2uint8, INT_UINT_CMP(PG_GETARG_INT16, PG_GETARG_UINT64))
+MIXED_CMP_FUNCS(int4uint8, INT_UINT_CMP(PG_GETARG_INT32, PG_GETARG_UINT64))
+MIXED_CMP_FUNCS(int8uint8, INT_UINT_CMP(PG_GETARG_INT64, PG_GETARG_UINT64))
+
+/* uintv op unsigned, and the reverse */
+#define PG_GETARG_UINTV_VALUE(n)	uintv_decode(PG_GETARG_UINTV_PP(n))
+
+#define UINT_UINT_CMP(getarg0, getarg1) \
+	uint_uint_cmp((uint64) getarg0(0), (uint64) getarg1(1))
+
+MIXED_CMP_FUNCS(uintvuint2, UINT_UINT_CMP(PG_GETARG_UINTV_VALUE, PG_GETARG_UINT16))
+MIXED_CMP_FUNCS(uintvuint4, UINT_UINT_CMP(PG_GETARG_UINTV_VALUE, PG_GETARG_UINT32))
+MIXED_CMP_FUNCS(uintvuint8, UINT_UINT_CMP(PG_GETARG_UINTV_VALUE, PG_GETARG_UINT64))
+MIXED_CMP_FUNCS(uint2uintv, UINT_UINT_CMP(PG_GETARG_UINT16, PG_GETARG_UINTV_VALUE))
+MIXED_CMP_FUNCS(uint4uintv, UINT_UINT_CMP(PG_GETARG_UINT32, PG_GETARG_UINTV_VALUE))
+MIXED_CMP_FUNCS(uint8uintv, UINT_UINT_CMP(PG_GETARG_UINT64, PG_GETARG_UINTV_VALUE))
+
+MIXED_CMP_FUNCS(uintvint2, UINT_INT_CMP(PG_GETARG_UINTV_VALUE, PG_GETARG_INT16))
+MIXED_CMP_FUNCS(uintvint4, UINT_INT_CMP(PG_GETARG_UINTV_VALUE, PG_GETARG_INT32))
+MIXED_CMP_FUNCS(uintvint8, UINT_INT_CMP(PG_GETARG_UINTV_VALUE, PG_GETARG_INT64))
+MIXED_CMP_FUNCS(int2uintv, INT_UINT_CMP(PG_GETARG_INT16, PG_GETARG_UINTV_VALUE))
+MIXED_CMP_FUNCS(int4uintv, INT_UINT_CMP(PG_GETARG_INT32, PG_GETARG_UINTV_VALUE))
+MIXED_CMP_FUNCS(int8uintv, INT_UINT_CMP(PG_GETARG_INT64, PG_GETARG_UINTV_VALUE))
@@ -12,61 +12,173 @@
  */
 
 #include "c.h"
+#include "port/pg_bitutils.h"
+#include "port/pg_bswap.h"
 #include "utils/elog.h"
 
 #include "uints_numutils.h"
 
-#include <stdlib.h>
-#include <limits.h>
+#include <ctype.h>
 
 /* Conveniently, never returns */
 static inline
 void
-report_invalid(char* s)
+report_invalid(const char* s, const char* type)
 {
 	ereport(ERROR,
 			(errcode(ERRCODE_INVALID_TEXT_REPRESENTATION),
-			 errmsg("invalid input syntax for unsgined integer: \"%s\"",
-					s)));
+			 errmsg("invalid input syntax for type %s: \"%s\"",
+					type, s)));
 }
 
 static inline
 void
-report_range_error(char* s, const char* type)
+report_range_error(const char* s, const char* type)
 {
 	ereport(ERROR,
 		(errcode(ERRCODE_NUMERIC_VALUE_OUT_OF_RANGE),
 		errmsg("value \"%s\" is out of range for type %s", s, type)));
 }
 
-static inline
-void
-validate_string(char* s)
-{
-	/*
-	 * Some versions of strtol treat the empty string as an error, but some
-	 * seem not to.  Make an explicit test to be sure we catch it.
-	 */
-	if (s == NULL)
-		elog(ERROR, "NULL pointer");
-	if (*s == 0)
-		report_invalid(s);
-}
-
 /*
  * Skip any trailing whitespace; if anything but whitespace remains before
  * the terminating character, bail out
  */
 static inline
 void
-skip_trailing_whitespace(char* s, char* end, int c)
+skip_trailing_whitespace(const char* s, const char* end, int c,
+						 const char* type)
 {
 	while (*end && *end != c && isspace((unsigned char) *end))
 		end++;
 
 	if (*end && *end != c)
-		report_invalid(s);
+		report_invalid(s, type);
+}
+
+static inline
+bool
+is_digit(char ch)
+{
+	return (unsigned char) (ch - '0') < 10;
 }
+
+/*
+ * Convert eight ASCII digits to their value without a per-digit loop: the
+ * digits are loaded as one word and combined pairwise into two-, four- and
+ * finally eight-digit values with a few multiplies.
+ */
+static inline
+uint32
+parse_eight_digits(const char* s)
+{
+	uint64		val;
+
+	memcpy(&val, s, sizeof(val));
+#ifdef WORDS_BIGENDIAN
+	/* the arithmetic below wants the first digit in the lowest byte */
+	val = pg_bswap64(val);
+#endif
+	val -= UINT64CONST(0x3030303030303030);
+	val = (val * 10) + (val >> 8);
+	val = (((val & UINT64CONST(0x000000FF000000FF)) *
+			UINT64CONST(0x000F424000000064)) +
+		   (((val >> 16) & UINT64CONST(0x000000FF000000FF)) *
+			UINT64CONST(0x0000271000000001))) >> 32;
+
+	return (uint32) val;
+}
+
+/* Value of ndigits (at most 19, so it can't overflow) digits */
+static inline
+uint64
+parse_digits(const char* s, int ndigits)
+{
+	uint64		result = 0;
+
+	for (; ndigits >= 8; ndigits -= 8, s += 8)
+		result = result * 100000000 + parse_eight_digits(s);
+
+	for (; ndigits > 0; ndigits--, s++)
+		result = result * 10 + (*s - '0');
+
+	return result;
+}
+
+/*
+ * Parse an unsigned integer no larger than max, which has maxdigits
+ * decimal digits.  Inlined into each pg_atouX with constant limits.
+ *
+ * Only a run of ASCII digits is accepted, optionally preceded by '+' and
+ * surrounded by whitespace.  A '-' is accepted only if the number is zero:
+ * any other negative value is out of range.
+ */
+static inline
+uint64
+parse_unsigned(char* s, int c, uint64 max, int maxdigits, const char* type)
+{
+	char	   *ptr = s;
+	char	   *digits;
+	bool		neg = false;
+	int			ndigits;
+	uint64		result;
+
+	if (s == NULL)
+		elog(ERROR, "NULL pointer");
+
+	/* skip leading spaces */
+	while (isspace((unsigned char) *ptr))
+		ptr++;
+
+	/* handle sign */
+	if (*ptr == '-')
+	{
+		neg = true;
+		ptr++;
+	}
+	else if (*ptr == '+')
+		ptr++;
+
+	digits = ptr;
+	while (is_digit(*ptr))
+		ptr++;
+
+	if (ptr == digits)
+		report_invalid(s, type);
+
+	skip_trailing_whitespace(s, ptr, c, type);
+
+	/* leading zeros don't count towards the length limit */
+	while (*digits == '0' && ptr - digits > 1)
+		digits++;
+	ndigits = ptr - digits;
+
+	if (ndigits > maxdigits)
+		report_range_error(s, type);
+
+	if (ndigits == 20)
+	{
+		/* only reachable for uint8: the last digit may overflow */
+		uint64		last = digits[19] - '0';
+
+		result = parse_digits(digits, 19);
+		if (result > (PG_UINT64_MAX - last) / 10)
+			report_range_error(s, type);
+		result = result * 10 + last;
+	}
+	else
+	{
+		result = parse_digits(digits, ndigits);
+		if (result > max)
+			report_range_error(s, type);
+	}
+
+	if (neg && result != 0)
+		report_range_error(s, type);
+
+	return result;
+}
+
 /*
  * pg_atouX: convert string to unsigned integer
  *
@@ -80,130 +192,256 @@ skip_trailing_whitespace(char* s, char* end, int c)
  */
 uint8 pg_atou1(char *s, int c)
 {
-	unsigned long int   l;
-	char                *badp;
+	return (uint8) parse_unsigned(s, c, PG_UINT8_MAX, MAXUINT1LEN, "uint1");
+}
+
+uint16 pg_atou2(char *s, int c)
+{
+	return (uint16) parse_unsigned(s, c, PG_UINT16_MAX, MAXUINT2LEN, "uint2");
+}
+
+uint32 pg_atou4(char *s, int c)
+{
+	return (uint32) parse_unsigned(s, c, PG_UINT32_MAX, MAXUINT4LEN, "uint4");
+}
 
-	validate_string(s);
-	errno = 0;
-	l = strtoul(s, &badp, 10);
+uint64 pg_atou8(char *s, int c)
+{
+	return parse_unsigned(s, c, PG_UINT64_MAX, MAXUINT8LEN, "uint8");
+}
 
-	if (s == badp)
-		report_invalid(s);
+/* uintv holds the values of uint8, but errors should name its own type */
+uint64 pg_atouv(char *s, int c)
+{
+	return parse_unsigned(s, c, PG_UINT64_MAX, MAXUINT8LEN, "uintv");
+}
 
-	if (errno == ERANGE || l > UCHAR_MAX)
-		report_range_error(s, "uint1");
+/*
+ * Pairs of digits for 00..99, so that the formatters below can emit two
+ * digits per division.
+ */
+static const char DIGIT_TABLE[200] =
+"00" "01" "02" "03" "04" "05" "06" "07" "08" "09"
+"10" "11" "12" "13" "14" "15" "16" "17" "18" "19"
+"20" "21" "22" "23" "24" "25" "26" "27" "28" "29"
+"30" "31" "32" "33" "34" "35" "36" "37" "38" "39"
+"40" "41" "42" "43" "44" "45" "46" "47" "48" "49"
+"50" "51" "52" "53" "54" "55" "56" "57" "58" "59"
+"60" "61" "62" "63" "64" "65" "66" "67" "68" "69"
+"70" "71" "72" "73" "74" "75" "76" "77" "78" "79"
+"80" "81" "82" "83" "84" "85" "86" "87" "88" "89"
+"90" "91" "92" "93" "94" "95" "96" "97" "98" "99";
 
-	skip_trailing_whitespace(s, badp, c);
+/*
+ * Number of decimal digits in a non-zero value.  The base-2 logarithm
+ * scaled by 1233/4096 (just under log10(2)) is the base-10 logarithm or one
+ * less; a single comparison against a power of ten settles which.
+ */
+static inline
+int
+decimalLength32(uint32 v)
+{
+	int			t;
+	static const uint32 PowersOfTen[] = {
+		1, 10, 100,
+		1000, 10000, 100000,
+		1000000, 10000000, 100000000,
+		1000000000
+	};
+
+	t = (pg_leftmost_one_pos32(v) + 1) * 1233 / 4096;
+	return t + (v >= PowersOfTen[t]);
+}
 
-	return (uint8)l;
+static inline
+int
+decimalLength64(uint64 v)
+{
+	int			t;
+	static const uint64 PowersOfTen[] = {
+		UINT64CONST(1), UINT64CONST(10),
+		UINT64CONST(100), UINT64CONST(1000),
+		UINT64CONST(10000), UINT64CONST(100000),
+		UINT64CONST(1000000), UINT64CONST(10000000),
+		UINT64CONST(100000000), UINT64CONST(1000000000),
+		UINT64CONST(10000000000), UINT64CONST(100000000000),
+		UINT64CONST(1000000000000), UINT64CONST(10000000000000),
+		UINT64CONST(100000000000000), UINT64CONST(1000000000000000),
+		UINT64CONST(10000000000000000), UINT64CONST(100000000000000000),
+		UINT64CONST(1000000000000000000), UINT64CONST(10000000000000000000)
+	};
+
+	t = (pg_leftmost_one_pos64(v) + 1) * 1233 / 4096;
+	return t + (v >= PowersOfTen[t]);
 }
 
-uint16 pg_atou2(char *s, int c)
+/*
+ * Write the digits of value at a, without a terminating NUL, and return
+ * their count.  The length is known up front, so the digits are stored
+ * right to left in their final places and no reversal is needed.
+ */
+static
+int
+pg_u4toa_n(uint32 value, char* a)
 {
-	unsigned long int   l;
-	char                *badp;
+	int			olength;
+	int			i = 0;
+
+	if (value == 0)
+	{
+		*a = '0';
+		return 1;
+	}
 
-	validate_string(s);
-	errno = 0;
-	l = strtoul(s, &badp, 10);
+	olength = decimalLength32(value);
 
-	if (s == badp)
-		report_invalid(s);
+	/* Four digits per iteration, two table lookups each */
+	while (value >= 10000)
+	{
+		const uint32 c = value - 10000 * (value / 10000);
+		const uint32 c0 = (c % 100) << 1;
+		const uint32 c1 = (c / 100) << 1;
+		char	   *pos = a + olength - i;
 
-	if (errno == ERANGE || l > USHRT_MAX)
-		report_range_error(s, "uint2");
+		value /= 10000;
 
-	skip_trailing_whitespace(s, badp, c);
+		memcpy(pos - 2, DIGIT_TABLE + c0, 2);
+		memcpy(pos - 4, DIGIT_TABLE + c1, 2);
+		i += 4;
+	}
+	if (value >= 100)
+	{
+		const uint32 c = (value % 100) << 1;
+		char	   *pos = a + olength - i;
+
+		value /= 100;
+
+		memcpy(pos - 2, DIGIT_TABLE + c, 2);
+		i += 2;
+	}
+	if (value >= 10)
+	{
+		const uint32 c = value << 1;
+		char	   *pos = a + olength - i;
+
+		memcpy(pos - 2, DIGIT_TABLE + c, 2);
+	}
+	else
+		*a = (char) ('0' + value);
 
-	return (uint16)l;
+	return olength;
 }
 
-uint32 pg_atou4(char *s, int c)
+static
+int
+pg_u8toa_n(uint64 value, char* a)
 {
-	unsigned long int   l;
-	char                *badp;
+	int			olength;
+	int			i = 0;
+	uint32		value2;
 
-	validate_string(s);
-	errno = 0;
-	l = strtoul(s, &badp, 10);
+	/* Values that fit in 32 bits never need a 64-bit division */
+	if ((value >> 32) == 0)
+		return pg_u4toa_n((uint32) value, a);
 
-	if (s == badp)
-		report_invalid(s);
+	olength = decimalLength64(value);
 
-	if (errno == ERANGE)
-		report_range_error(s, "uint4");
+	/*
+	 * Peel off eight digits at a time with one 64-bit division; the
+	 * remainder is then split up using 32-bit arithmetic only.
+	 */
+	while (value >= 100000000)
+	{
+		const uint64 q = value / 100000000;
+		uint32		value3 = (uint32) (value - 100000000 * q);
+		const uint32 c = value3 % 10000;
+		const uint32 d = value3 / 10000;
+		const uint32 c0 = (c % 100) << 1;
+		const uint32 c1 = (c / 100) << 1;
+		const uint32 d0 = (d % 100) << 1;
+		const uint32 d1 = (d / 100) << 1;
+		char	   *pos = a + olength - i;
+
+		value = q;
+
+		memcpy(pos - 2, DIGIT_TABLE + c0, 2);
+		memcpy(pos - 4, DIGIT_TABLE + c1, 2);
+		memcpy(pos - 6, DIGIT_TABLE + d0, 2);
+		memcpy(pos - 8, DIGIT_TABLE + d1, 2);
+		i += 8;
+	}
 
-	skip_trailing_whitespace(s, badp, c);
+	/* Fewer than eight digits remain, so switch to 32-bit arithmetic */
+	value2 = (uint32) value;
 
-	return l;
-}
+	if (value2 >= 10000)
+	{
+		const uint32 c = value2 - 10000 * (value2 / 10000);
+		const uint32 c0 = (c % 100) << 1;
+		const uint32 c1 = (c / 100) << 1;
+		char	   *pos = a + olength - i;
 
-uint64 pg_atou8(char *s, int c)
-{
-	uint8	l;
-	char	*badp;
+		value2 /= 10000;
 
-	validate_string(s);
-	errno = 0;
-	l = strtoull(s, &badp, 10);
+		memcpy(pos - 2, DIGIT_TABLE + c0, 2);
+		memcpy(pos - 4, DIGIT_TABLE + c1, 2);
+		i += 4;
+	}
+	if (value2 >= 100)
+	{
+		const uint32 c = (value2 % 100) << 1;
+		char	   *pos = a + olength - i;
 
-	if (s == badp)
-		report_invalid(s);
+		value2 /= 100;
 
-	if (errno == ERANGE)
-		report_range_error(s, "uint8");
+		memcpy(pos - 2, DIGIT_TABLE + c, 2);
+		i += 2;
+	}
+	if (value2 >= 10)
+	{
+		const uint32 c = value2 << 1;
+		char	   *pos = a + olength - i;
 
-	skip_trailing_whitespace(s, badp, c);
+		memcpy(pos - 2, DIGIT_TABLE + c, 2);
+	}
+	else
+		*a = (char) ('0' + value2);
 
-	return l;
+	return olength;
 }
 
-
-void
+/*
+ * pg_uXtoa: convert unsigned integer to its decimal representation
+ *
+ * a must have room for MAXUINTnLEN + 1 bytes.  The result is NUL-terminated,
+ * and its length (not counting the NUL) is returned.
+ */
+int
 pg_u1toa(uint8 i, char* a)
 {
-	pg_u4toa((uint32)i, a);
+	return pg_u4toa((uint32)i, a);
 }
 
-void
+int
 pg_u2toa(uint16 i, char* a)
 {
-	pg_u4toa((uint32)i, a);
+	return pg_u4toa((uint32)i, a);
 }
 
-void
+int
 pg_u4toa(uint32 i, char* a)
 {
-	pg_u8toa((uint64)i, a);
+	int			len = pg_u4toa_n(i, a);
 
+	a[len] = '\0';
+	return len;
 }
 
-void
-pg_u8toa(uint64 value, char* a)
+int
+pg_u8toa(uint64 i, char* a)
 {
-	char	   *start = a;
-
-	/* Compute the result string backwards. */
-	do
-	{
-		uint64		remainder;
-		uint64		oldval = value;
-
-		value /= 10;
-		remainder = oldval - value * 10;
-		*a++ = '0' + remainder;
-	} while (value != 0);
-
-	/* Add trailing NUL byte, and back up 'a' to the last character. */
-	*a-- = '\0';
-
-	/* Reverse string. */
-	while (start < a)
-	{
-		char		swap = *start;
-
-		*start++ = *a;
-		*a-- = swap;
-	}
+	int			len = pg_u8toa_n(i, a);
 
+	a[len] = '\0';
+	return len;
 }
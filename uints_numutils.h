@@ -17,11 +17,18 @@ extern uint8 pg_atou1(char *s, int c);
 extern uint16 pg_atou2(char *s, int c);
 extern uint32 pg_atou4(char *s, int c);
 extern uint64 pg_atou8(char *s, int c);
+extern uint64 pg_atouv(char *s, int c);
 
-extern void pg_u1toa(uint8 i, char* a);
-extern void pg_u2toa(uint16 i, char* a);
-extern void pg_u4toa(uint32 i, char* a);
-extern void pg_u8toa(uint64 i, char* a);
+/* Maximum number of decimal digits, not counting the terminating NUL */
+#define MAXUINT1LEN 3
+#define MAXUINT2LEN 5
+#define MAXUINT4LEN 10
+#define MAXUINT8LEN 20
+
+extern int pg_u1toa(uint8 i, char* a);
+extern int pg_u2toa(uint16 i, char* a);
+extern int pg_u4toa(uint32 i, char* a);
+extern int pg_u8toa(uint64 i, char* a);
 
 
 #endif
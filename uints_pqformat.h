@@ -0,0 +1,79 @@
+/*-------------------------------------------------------------------------
+ *
+ * uints_pqformat.h
+ *	  Binary send/receive of fixed-width unsigned integers
+ *
+ *	  The send functions build their exact-size bytea in one allocation,
+ *	  where pq_begintypsend would allocate a 1kB StringInfo for every value,
+ *	  and the receive functions read the value straight out of the message
+ *	  buffer.  Binary COPY calls these once per column per row.
+ *
+ * Portions Copyright (c) 1996-2013, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ *
+ *-------------------------------------------------------------------------
+ */
+#ifndef UINTS_PQFORMAT_H
+#define UINTS_PQFORMAT_H
+
+#include "lib/stringinfo.h"
+#include "port/pg_bswap.h"
+#if PG_VERSION_NUM >= 160000
+#include "varatt.h"
+#endif
+
+/* A bytea holding the len bytes at data */
+static inline bytea *
+uint_sendbytes(const void *data, int len)
+{
+	bytea	   *result = (bytea *) palloc(VARHDRSZ + len);
+
+	SET_VARSIZE(result, VARHDRSZ + len);
+	memcpy(VARDATA(result), data, len);
+	return result;
+}
+
+/* Consume len bytes of the message, returning where they start */
+static inline const char *
+uint_getmsgbytes(StringInfo msg, int len)
+{
+	const char *result;
+
+	if (unlikely(msg->cursor < 0 || len > msg->len - msg->cursor))
+		ereport(ERROR,
+				(errcode(ERRCODE_PROTOCOL_VIOLATION),
+				 errmsg("insufficient data left in message")));
+	result = msg->data + msg->cursor;
+	msg->cursor += len;
+	return result;
+}
+
+static inline uint16
+uint_getmsg16(StringInfo msg)
+{
+	uint16		n;
+
+	memcpy(&n, uint_getmsgbytes(msg, sizeof(n)), sizeof(n));
+	return pg_ntoh16(n);
+}
+
+static inline uint32
+uint_getmsg32(StringInfo msg)
+{
+	uint32		n;
+
+	memcpy(&n, uint_getmsgbytes(msg, sizeof(n)), sizeof(n));
+	return pg_ntoh32(n);
+}
+
+static inline uint64
+uint_getmsg64(StringInfo msg)
+{
+	uint64		n;
+
+	memcpy(&n, uint_getmsgbytes(msg, sizeof(n)), sizeof(n));
+	return pg_ntoh64(n);
+}
+
+#endif							/* UINTS_PQFORMAT_H */
@@ -0,0 +1,108 @@
+/*-------------------------------------------------------------------------
+ *
+ * uints_range.c
+ *	  Support functions for the unsigned integer range types
+ *
+ *	  uint4range and uint8range are discrete: the canonical functions turn
+ *	  every range into the [lower, upper) form, as int4range_canonical does.
+ *	  Indexing uses the core range operator classes.
+ *
+ * Portions Copyright (c) 1996-2013, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include "fmgr.h"
+#include "utils/rangetypes.h"
+
+#include "declare.h"
+#include "uints_fmgr.h"
+
+/* Defined in uint.c and uint8.c */
+extern Datum uint4inc(PG_FUNCTION_ARGS);
+extern Datum uint8inc(PG_FUNCTION_ARGS);
+
+/*
+ * Make an exclusive lower bound inclusive, and an inclusive upper bound
+ * exclusive, by adding one with incfn.
+ */
+static RangeType *
+uint_range_canonical(FunctionCallInfo fcinfo, PGFunction incfn)
+{
+	RangeType  *r = PG_GETARG_RANGE_P(0);
+	TypeCacheEntry *typcache;
+	RangeBound	lower;
+	RangeBound	upper;
+	bool		empty;
+
+	typcache = range_get_typcache(fcinfo, RangeTypeGetOid(r));
+
+	range_deserialize(typcache, r, &lower, &upper, &empty);
+
+	if (empty)
+		return r;
+
+	if (!lower.infinite && !lower.inclusive)
+	{
+		lower.val = DirectFunctionCall1(incfn, lower.val);
+		lower.inclusive = true;
+	}
+
+	if (!upper.infinite && upper.inclusive)
+	{
+		upper.val = DirectFunctionCall1(incfn, upper.val);
+		upper.inclusive = false;
+	}
+
+#if PG_VERSION_NUM >= 160000
+	return range_serialize(typcache, &lower, &upper, false, fcinfo->context);
+#else
+	return range_serialize(typcache, &lower, &upper, false);
+#endif
+}
+
+DECLARE(uint4range_canonical)
+Datum
+uint4range_canonical(PG_FUNCTION_ARGS)
+{
+	PG_RETURN_RANGE_P(uint_range_canonical(fcinfo, uint4inc));
+}
+
+DECLARE(uint8range_canonical)
+Datum
+uint8range_canonical(PG_FUNCTION_ARGS)
+{
+	PG_RETURN_RANGE_P(uint_range_canonical(fcinfo, uint8inc));
+}
+
+/*
+ * Subtype difference functions, used by the GiST penalty.  The result may
+ * be negative, so compute it in double.
+ */
+
+DECLARE(uint4range_subdiff)
+Datum
+uint4range_subdiff(PG_FUNCTION_ARGS)
+{
+	uint32		arg1 = PG_GETARG_UINT32(0);
+	uint32		arg2 = PG_GETARG_UINT32(1);
+
+	PG_RETURN_FLOAT8((float8) arg1 - (float8) arg2);
+}
+
+DECLARE(uint8range_subdiff)
+Datum
+uint8range_subdiff(PG_FUNCTION_ARGS)
+{
+	uint64		arg1 = PG_GETARG_UINT64(0);
+	uint64		arg2 = PG_GETARG_UINT64(1);
+
+	/* subtract the smaller from the larger first, to keep precision */
+	if (arg1 >= arg2)
+		PG_RETURN_FLOAT8((float8) (arg1 - arg2));
+	else
+		PG_RETURN_FLOAT8(-(float8) (arg2 - arg1));
+}
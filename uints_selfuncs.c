@@ -0,0 +1,334 @@
+/*-------------------------------------------------------------------------
+ *
+ * uints_selfuncs.c
+ *	  Restriction selectivity estimators for unsigned integer comparisons
+ *
+ *	  The core scalarltsel() and friends can only interpolate within a
+ *	  histogram bin for the built-in types they know how to convert to
+ *	  double; for any other type they assume the constant sits in the middle
+ *	  of its bin.  These estimators follow the same MCV + histogram logic,
+ *	  but convert the unsigned values themselves, so that interpolation also
+ *	  works for values above INT_MAX.
+ *
+ * Portions Copyright (c) 1996-2013, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include "access/htup_details.h"
+#include "catalog/pg_statistic.h"
+#include "catalog/pg_type.h"
+#include "nodes/pathnodes.h"
+#include "utils/lsyscache.h"
+#include "utils/selfuncs.h"
+#include "utils/syscache.h"
+
+#include "declare.h"
+#include "uintv.h"
+#include "uints_fmgr.h"
+
+/* OIDs of the extension's integer types */
+typedef struct
+{
+	Oid			uint1;
+	Oid			uint2;
+	Oid			uint4;
+	Oid			uint8;
+	Oid			uintv;
+} UintTypeOids;
+
+/*
+ * The types have no fixed OIDs.  They live in the extension's schema,
+ * which is that of the estimator being called, fn_oid.
+ */
+static void
+uint_type_oids(Oid fn_oid, UintTypeOids *oids)
+{
+	Oid			nspid = get_func_namespace(fn_oid);
+
+#define LOOKUP(name) \
+	GetSysCacheOid2(TYPENAMENSP, Anum_pg_type_oid, \
+					CStringGetDatum(name), ObjectIdGetDatum(nspid))
+
+	oids->uint1 = LOOKUP("uint1");
+	oids->uint2 = LOOKUP("uint2");
+	oids->uint4 = LOOKUP("uint4");
+	oids->uint8 = LOOKUP("uint8");
+	oids->uintv = LOOKUP("uintv");
+
+#undef LOOKUP
+}
+
+/*
+ * Convert a value of one of the extension's types, or of a signed integer
+ * type, to uint64.  Negative signed values are clamped to zero, which sorts
+ * them below every unsigned value.  Returns false for types we can't handle.
+ */
+static bool
+uint_datum_to_uint64(Datum value, Oid typid, const UintTypeOids *oids,
+					 uint64 *result)
+{
+	int64		sval;
+
+	switch (typid)
+	{
+		case INT2OID:
+			sval = DatumGetInt16(value);
+			break;
+		case INT4OID:
+			sval = DatumGetInt32(value);
+			break;
+		case INT8OID:
+			sval = DatumGetInt64(value);
+			break;
+		default:
+			if (typid == oids->uint1)
+				*result = DatumGetUInt8(value);
+			else if (typid == oids->uint2)
+				*result = DatumGetUInt16(value);
+			else if (typid == oids->uint4)
+				*result = DatumGetUInt32(value);
+			else if (typid == oids->uint8)
+				*result = DatumGetUInt64(value);
+			else if (typid == oids->uintv)
+				*result = uintv_decode(DatumGetUintVP(value));
+			else
+				return false;
+			return true;
+	}
+
+	*result = (sval < 0) ? 0 : (uint64) sval;
+	return true;
+}
+
+/*
+ * Fraction of the histogram below constval, interpolating linearly within
+ * the bin that contains it, or above it if isgt.  If iseq, constval itself
+ * counts as below (or above).  Returns -1 if there is no usable histogram.
+ */
+static double
+uint_histogram_selectivity(VariableStatData *vardata, const UintTypeOids *oids,
+						   uint64 constval, bool isgt, bool iseq)
+{
+	AttStatsSlot sslot;
+	double		hist_selec = -1.0;
+
+	if (!get_attstatsslot(&sslot, vardata->statsTuple,
+						  STATISTIC_KIND_HISTOGRAM, InvalidOid,
+						  ATTSTATSSLOT_VALUES))
+		return hist_selec;
+
+	if (sslot.nvalues > 1)
+	{
+		Oid			typid = vardata->atttype;
+		int			nvalues = sslot.nvalues;
+		bool		all_below = false;
+		uint64		first;
+		uint64		last;
+		double		histfrac;
+
+		if (!uint_datum_to_uint64(sslot.values[0], typid, oids, &first) ||
+			!uint_datum_to_uint64(sslot.values[nvalues - 1], typid, oids, &last))
+		{
+			free_attstatsslot(&sslot);
+			return hist_selec;
+		}
+
+		/*
+		 * For integers "var <= c" is "var < c + 1", and "var > c" is the
+		 * complement of that, so those look for the values below c + 1.
+		 */
+		if (isgt != iseq)
+		{
+			if (constval == PG_UINT64_MAX)
+				all_below = true;
+			else
+				constval++;
+		}
+
+		if (all_below)
+			histfrac = 1.0;
+		else if (constval < first)
+			histfrac = 0.0;
+		else if (constval >= last)
+			histfrac = 1.0;
+		else
+		{
+			int			lo = 0;
+			int			hi = nvalues - 1;
+			uint64		lobound;
+			uint64		hibound;
+			double		binfrac;
+
+			/* Invariant: values[lo] <= constval < values[hi] */
+			while (hi - lo > 1)
+			{
+				int			mid = (lo + hi) / 2;
+				uint64		midval;
+
+				uint_datum_to_uint64(sslot.values[mid], typid, oids, &midval);
+				if (midval <= constval)
+					lo = mid;
+				else
+					hi = mid;
+			}
+
+			uint_datum_to_uint64(sslot.values[lo], typid, oids, &lobound);
+			uint_datum_to_uint64(sslot.values[hi], typid, oids, &hibound);
+
+			if (hibound > lobound)
+				binfrac = (double) (constval - lobound) /
+					(double) (hibound - lobound);
+			else
+				binfrac = 0.5;
+
+			histfrac = ((double) lo + binfrac) / (double) (nvalues - 1);
+		}
+
+		hist_selec = isgt ? 1.0 - histfrac : histfrac;
+	}
+
+	free_attstatsslot(&sslot);
+
+	return hist_selec;
+}
+
+/*
+ * Common code for the inequality estimators: selectivity of
+ * "var < const" (or "var > const" if isgt, with "=" added if iseq).
+ * fn_oid is the estimator being called.
+ */
+static double
+uint_ineq_selectivity(PlannerInfo *root, Oid operator, List *args,
+					  int varRelid, Oid fn_oid, bool isgt, bool iseq)
+{
+	VariableStatData vardata;
+	Node	   *other;
+	bool		varonleft;
+	Const	   *constnode;
+	UintTypeOids oids;
+	uint64		constval;
+	FmgrInfo	opproc;
+	Form_pg_statistic stats;
+	double		mcv_selec;
+	double		hist_selec;
+	double		sumcommon;
+	double		selec;
+
+	if (!get_restriction_variable(root, args, varRelid,
+								  &vardata, &other, &varonleft))
+		return DEFAULT_INEQ_SEL;
+
+	if (!IsA(other, Const))
+	{
+		ReleaseVariableStats(vardata);
+		return DEFAULT_INEQ_SEL;
+	}
+
+	constnode = (Const *) other;
+
+	/* Comparisons to NULL never succeed */
+	if (constnode->constisnull)
+	{
+		ReleaseVariableStats(vardata);
+		return 0.0;
+	}
+
+	if (!HeapTupleIsValid(vardata.statsTuple))
+	{
+		ReleaseVariableStats(vardata);
+		return DEFAULT_INEQ_SEL;
+	}
+
+	uint_type_oids(fn_oid, &oids);
+
+	if (!uint_datum_to_uint64(constnode->constvalue, constnode->consttype,
+							  &oids, &constval))
+	{
+		ReleaseVariableStats(vardata);
+		return DEFAULT_INEQ_SEL;
+	}
+
+	/* "const < var" is "var > const" */
+	if (!varonleft)
+		isgt = !isgt;
+
+	stats = (Form_pg_statistic) GETSTRUCT(vardata.statsTuple);
+
+	fmgr_info(get_opcode(operator), &opproc);
+	mcv_selec = mcv_selectivity(&vardata, &opproc, InvalidOid,
+								constnode->constvalue, varonleft,
+								&sumcommon);
+
+	hist_selec = uint_histogram_selectivity(&vardata, &oids, constval,
+											isgt, iseq);
+
+	selec = 1.0 - stats->stanullfrac - sumcommon;
+
+	if (hist_selec >= 0.0)
+		selec *= hist_selec;
+	else
+	{
+		/*
+		 * If no histogram but there are values not accounted for by MCV,
+		 * arbitrarily assume half of them will match.
+		 */
+		selec *= 0.5;
+	}
+
+	selec += mcv_selec;
+
+	ReleaseVariableStats(vardata);
+
+	CLAMP_PROBABILITY(selec);
+
+	return selec;
+}
+
+/*
+ *		uint_scalarltsel	- selectivity of "<"
+ *		uint_scalarlesel	- selectivity of "<="
+ *		uint_scalargtsel	- selectivity of ">"
+ *		uint_scalargesel	- selectivity of ">="
+ */
+
+#define UINT_INEQ_SEL_BODY(isgt, iseq) \
+	PlannerInfo *root = (PlannerInfo *) PG_GETARG_POINTER(0); \
+	Oid			operator = PG_GETARG_OID(1); \
+	List	   *args = (List *) PG_GETARG_POINTER(2); \
+	int			varRelid = PG_GETARG_INT32(3); \
+	\
+	PG_RETURN_FLOAT8(uint_ineq_selectivity(root, operator, args, varRelid, \
+										   fcinfo->flinfo->fn_oid, \
+										   isgt, iseq))
+
+DECLARE(uint_scalarltsel)
+Datum
+uint_scalarltsel(PG_FUNCTION_ARGS)
+{
+	UINT_INEQ_SEL_BODY(false, false);
+}
+
+DECLARE(uint_scalarlesel)
+Datum
+uint_scalarlesel(PG_FUNCTION_ARGS)
+{
+	UINT_INEQ_SEL_BODY(false, true);
+}
+
+DECLARE(uint_scalargtsel)
+Datum
+uint_scalargtsel(PG_FUNCTION_ARGS)
+{
+	UINT_INEQ_SEL_BODY(true, false);
+}
+
+DECLARE(uint_scalargesel)
+Datum
+uint_scalargesel(PG_FUNCTION_ARGS)
+{
+	UINT_INEQ_SEL_BODY(true, true);
+}
@@ -0,0 +1,255 @@
+/*-------------------------------------------------------------------------
+ *
+ * uints_series.c
+ *	  generate_series() for uint4 and uint8
+ *
+ *	  The series are produced in materialize mode: the whole result goes
+ *	  into a tuplestore in one call, instead of one function call per value.
+ *	  The step is an int8, so that it can be negative, and is applied in
+ *	  64-bit unsigned arithmetic that stops before passing either end of
+ *	  the type's range.
+ *
+ *	  The support function gives the planner the row count of a series whose
+ *	  arguments it can estimate, as core does for the integer series.
+ *
+ * Portions Copyright (c) 1996-2013, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include "fmgr.h"
+#include "funcapi.h"
+#include "miscadmin.h"
+#include "nodes/nodeFuncs.h"
+#include "nodes/supportnodes.h"
+#include "optimizer/optimizer.h"
+#include "utils/tuplestore.h"
+
+#include "declare.h"
+#include "uints_fmgr.h"
+
+/* Set up materialize mode for a function returning a set of scalars */
+static Tuplestorestate *
+uint_series_begin(FunctionCallInfo fcinfo, TupleDesc *tupdesc)
+{
+	ReturnSetInfo *rsinfo = (ReturnSetInfo *) fcinfo->resultinfo;
+	Tuplestorestate *tupstore;
+	MemoryContext oldcontext;
+	Oid			rettype;
+
+	if (rsinfo == NULL || !IsA(rsinfo, ReturnSetInfo))
+		ereport(ERROR,
+				(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+				 errmsg("set-valued function called in context that cannot accept a set")));
+	if (!(rsinfo->allowedModes & SFRM_Materialize))
+		ereport(ERROR,
+				(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+				 errmsg("materialize mode required, but it is not allowed in this context")));
+	if (get_call_result_type(fcinfo, &rettype, NULL) != TYPEFUNC_SCALAR)
+		elog(ERROR, "return type must be a scalar type");
+
+	oldcontext = MemoryContextSwitchTo(rsinfo->econtext->ecxt_per_query_memory);
+
+	*tupdesc = CreateTemplateTupleDesc(1);
+	TupleDescInitEntry(*tupdesc, (AttrNumber) 1, "generate_series",
+					   rettype, -1, 0);
+
+	tupstore = tuplestore_begin_heap(rsinfo->allowedModes & SFRM_Materialize_Random,
+									 false, work_mem);
+	rsinfo->returnMode = SFRM_Materialize;
+	rsinfo->setResult = tupstore;
+	rsinfo->setDesc = *tupdesc;
+
+	MemoryContextSwitchTo(oldcontext);
+
+	return tupstore;
+}
+
+/*
+ * Produce start, start + step, ... up to finish.  wide says whether the
+ * values are uint8 rather than uint4.
+ */
+static Datum
+uint_series(FunctionCallInfo fcinfo, uint64 start, uint64 finish, int64 step,
+			bool wide)
+{
+	Tuplestorestate *tupstore;
+	TupleDesc	tupdesc;
+	uint64		current = start;
+	uint64		abs_step;
+
+	if (step == 0)
+		ereport(ERROR,
+				(errcode(ERRCODE_INVALID_PARAMETER_VALUE),
+				 errmsg("step size cannot equal zero")));
+
+	tupstore = uint_series_begin(fcinfo, &tupdesc);
+
+	if (step > 0 ? start > finish : start < finish)
+		return (Datum) 0;
+
+	/* negating in uint64 is fine for INT64_MIN too */
+	abs_step = step > 0 ? (uint64) step : (uint64) 0 - (uint64) step;
+
+	for (;;)
+	{
+		Datum		value;
+		bool		isnull = false;
+
+		value = wide ? Int64GetDatum((int64) current)
+			: UInt32GetDatum((uint32) current);
+		tuplestore_putvalues(tupstore, tupdesc, &value, &isnull);
+
+		/* stop when the next value would pass finish, or wrap around */
+		if (step > 0)
+		{
+			if (finish - current < abs_step)
+				break;
+			current += abs_step;
+		}
+		else
+		{
+			if (current - finish < abs_step)
+				break;
+			current -= abs_step;
+		}
+
+		CHECK_FOR_INTERRUPTS();
+	}
+
+	return (Datum) 0;
+}
+
+DECLARE(generate_series_uint4)
+Datum
+generate_series_uint4(PG_FUNCTION_ARGS)
+{
+	return uint_series(fcinfo, PG_GETARG_UINT32(0), PG_GETARG_UINT32(1), 1,
+					   false);
+}
+
+DECLARE(generate_series_step_uint4)
+Datum
+generate_series_step_uint4(PG_FUNCTION_ARGS)
+{
+	return uint_series(fcinfo, PG_GETARG_UINT32(0), PG_GETARG_UINT32(1),
+					   PG_GETARG_INT64(2), false);
+}
+
+DECLARE(generate_series_uint8)
+Datum
+generate_series_uint8(PG_FUNCTION_ARGS)
+{
+	return uint_series(fcinfo, PG_GETARG_UINT64(0), PG_GETARG_UINT64(1), 1,
+					   true);
+}
+
+DECLARE(generate_series_step_uint8)
+Datum
+generate_series_step_uint8(PG_FUNCTION_ARGS)
+{
+	return uint_series(fcinfo, PG_GETARG_UINT64(0), PG_GETARG_UINT64(1),
+					   PG_GETARG_INT64(2), true);
+}
+
+/* Number of values uint_series produces */
+static double
+uint_series_rows(uint64 start, uint64 finish, int64 step)
+{
+	if (step > 0)
+	{
+		if (start > finish)
+			return 0;
+		return (double) ((finish - start) / (uint64) step) + 1;
+	}
+	else
+	{
+		if (start < finish)
+			return 0;
+		return (double) ((start - finish) / ((uint64) 0 - (uint64) step)) + 1;
+	}
+}
+
+/* The value of a non-null uint4 or uint8 constant, by its width */
+static uint64
+uint_const_value(Const *c)
+{
+	if (c->constlen == sizeof(uint32))
+		return DatumGetUInt32(c->constvalue);
+	return (uint64) DatumGetInt64(c->constvalue);
+}
+
+/*
+ * Planner support function for generate_series(uint4/uint8)
+ *
+ * The arguments go through estimate_expression_value, which also gives
+ * the values of bound Params and stable expressions.  If only the step is
+ * unknown, assume a step of one in the direction of finish, which gives
+ * the largest row count possible.
+ */
+DECLARE(generate_series_uint_support)
+Datum
+generate_series_uint_support(PG_FUNCTION_ARGS)
+{
+	Node	   *rawreq = (Node *) PG_GETARG_POINTER(0);
+	Node	   *ret = NULL;
+
+	if (IsA(rawreq, SupportRequestRows))
+	{
+		/* Try to estimate the number of rows returned */
+		SupportRequestRows *req = (SupportRequestRows *) rawreq;
+
+		if (is_funcclause(req->node))	/* be paranoid */
+		{
+			List	   *args = ((FuncExpr *) req->node)->args;
+			Node	   *arg1;
+			Node	   *arg2;
+			Node	   *arg3 = NULL;
+
+			/* We can use estimated argument values here */
+			arg1 = estimate_expression_value(req->root, linitial(args));
+			arg2 = estimate_expression_value(req->root, lsecond(args));
+			if (list_length(args) >= 3)
+				arg3 = estimate_expression_value(req->root, lthird(args));
+
+			if (IsA(arg1, Const) && IsA(arg2, Const))
+			{
+				Const	   *start = (Const *) arg1;
+				Const	   *finish = (Const *) arg2;
+				Const	   *step = (arg3 && IsA(arg3, Const)) ? (Const *) arg3 : NULL;
+
+				/* a NULL argument means no rows; zero step is an error */
+				if (start->constisnull || finish->constisnull ||
+					(step != NULL && step->constisnull))
+				{
+					req->rows = 0;
+					ret = (Node *) req;
+				}
+				else
+				{
+					uint64		from = uint_const_value(start);
+					uint64		to = uint_const_value(finish);
+					int64		stepval;
+
+					if (arg3 == NULL)
+						stepval = 1;
+					else if (step != NULL)
+						stepval = DatumGetInt64(step->constvalue);
+					else
+						stepval = from <= to ? 1 : -1;
+
+					if (stepval != 0)
+					{
+						req->rows = uint_series_rows(from, to, stepval);
+						ret = (Node *) req;
+					}
+				}
+			}
+		}
+	}
+
+	PG_RETURN_POINTER(ret);
+}
@@ -0,0 +1,560 @@
+/*-------------------------------------------------------------------------
+ *
+ * uints_set.c
+ *	  uint4set, a compressed set of uint4 values
+ *
+ *	  A uint4set holds sorted, distinct values in blocks of up to
+ *	  UINT4SET_BLOCK_SIZE.  Each block has a header with its first and last
+ *	  value, and stores the gaps between consecutive values minus one,
+ *	  bit-packed at the smallest width that fits the block's largest gap.
+ *	  Dense ID lists thus take a few bits per value instead of four bytes.
+ *
+ *	  The block headers let the operators skip data they don't need:
+ *	  membership decodes a single block, intersection never decodes blocks
+ *	  that don't overlap the other input, and union copies such blocks to
+ *	  the result still packed.
+ *
+ * Portions Copyright (c) 1996-2013, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include "fmgr.h"
+#include "lib/stringinfo.h"
+#include "port/pg_bitutils.h"
+#include "utils/array.h"
+#include "utils/lsyscache.h"
+
+#include "declare.h"
+#include "uints_array.h"
+#include "uints_fmgr.h"
+#include "uints_numutils.h"
+
+#define UINT4SET_BLOCK_SIZE 128
+
+typedef struct
+{
+	int32		vl_len_;		/* varlena header (do not touch directly!) */
+	uint32		nvalues;		/* total number of values */
+	uint32		nblocks;		/* number of block headers */
+	/* Uint4SetBlock blocks[nblocks], then the packed gaps */
+} Uint4Set;
+
+typedef struct
+{
+	uint32		first;			/* smallest value in the block */
+	uint32		last;			/* largest value in the block */
+	uint32		offset;			/* start of the packed gaps in the data */
+	uint16		nvalues;		/* values in the block, 1..BLOCK_SIZE */
+	uint8		bits;			/* width of each packed gap, 0..32 */
+} Uint4SetBlock;
+
+#define UINT4SET_BLOCKS(s) \
+	((const Uint4SetBlock *) ((const char *) (s) + sizeof(Uint4Set)))
+#define UINT4SET_DATA(s) \
+	((const uint8 *) (UINT4SET_BLOCKS(s) + (s)->nblocks))
+#define UINT4SET_PACKED_LEN(blk) \
+	((((Size) (blk)->nvalues - 1) * (blk)->bits + 7) / 8)
+
+#define PG_GETARG_UINT4SET_P(n) ((Uint4Set *) PG_DETOAST_DATUM(PG_GETARG_DATUM(n)))
+
+/*
+ * Unpack a block into out, which must have room for UINT4SET_BLOCK_SIZE
+ * values.  Returns the number of values.
+ */
+static int
+uint4set_unpack(const Uint4Set *set, const Uint4SetBlock *blk, uint32 *out)
+{
+	const uint8 *p = UINT4SET_DATA(set) + blk->offset;
+	int			bits = blk->bits;
+	uint64		mask = (UINT64CONST(1) << bits) - 1;
+	uint64		buf = 0;
+	int			avail = 0;
+	uint32		v = blk->first;
+	int			i;
+
+	out[0] = v;
+	for (i = 1; i < blk->nvalues; i++)
+	{
+		while (avail < bits)
+		{
+			buf |= (uint64) *p++ << avail;
+			avail += 8;
+		}
+		v += (uint32) (buf & mask) + 1;
+		buf >>= bits;
+		avail -= bits;
+		out[i] = v;
+	}
+
+	return blk->nvalues;
+}
+
+/*
+ * Builder for a new set.  Values must be added in increasing order; whole
+ * packed blocks of another set may be added in between, as long as they
+ * keep the order.
+ */
+typedef struct
+{
+	StringInfoData blocks;
+	StringInfoData data;
+	uint32		nvalues;
+	int			npending;
+	uint32		pending[UINT4SET_BLOCK_SIZE];
+} Uint4SetBuilder;
+
+static void
+uint4set_builder_init(Uint4SetBuilder *b)
+{
+	initStringInfo(&b->blocks);
+	initStringInfo(&b->data);
+	b->nvalues = 0;
+	b->npending = 0;
+}
+
+/* Pack the pending values into a new block */
+static void
+uint4set_builder_flush(Uint4SetBuilder *b)
+{
+	const uint32 *v = b->pending;
+	int			n = b->npending;
+	Uint4SetBlock blk;
+	uint32		gaps = 0;
+	uint64		buf = 0;
+	int			used = 0;
+	uint8	   *p;
+	int			i;
+
+	if (n == 0)
+		return;
+
+	/* Zero the padding too, so that equal sets are stored identically */
+	memset(&blk, 0, sizeof(blk));
+
+	/* OR-ing the gaps gives the same bit length as taking their maximum */
+	for (i = 1; i < n; i++)
+		gaps |= v[i] - v[i - 1] - 1;
+
+	blk.first = v[0];
+	blk.last = v[n - 1];
+	blk.offset = b->data.len;
+	blk.nvalues = n;
+	blk.bits = gaps ? pg_leftmost_one_pos32(gaps) + 1 : 0;
+
+	enlargeStringInfo(&b->data, UINT4SET_PACKED_LEN(&blk));
+	p = (uint8 *) b->data.data + b->data.len;
+	for (i = 1; i < n; i++)
+	{
+		buf |= (uint64) (v[i] - v[i - 1] - 1) << used;
+		used += blk.bits;
+		while (used >= 8)
+		{
+			*p++ = (uint8) buf;
+			buf >>= 8;
+			used -= 8;
+		}
+	}
+	if (used > 0)
+		*p = (uint8) buf;
+	b->data.len += UINT4SET_PACKED_LEN(&blk);
+
+	appendBinaryStringInfo(&b->blocks, (char *) &blk, sizeof(blk));
+	b->nvalues += n;
+	b->npending = 0;
+}
+
+static inline void
+uint4set_builder_add(Uint4SetBuilder *b, uint32 value)
+{
+	b->pending[b->npending++] = value;
+	if (b->npending == UINT4SET_BLOCK_SIZE)
+		uint4set_builder_flush(b);
+}
+
+/* Copy a block of set as it is */
+static void
+uint4set_builder_add_block(Uint4SetBuilder *b, const Uint4Set *set,
+						   const Uint4SetBlock *blk)
+{
+	Uint4SetBlock copy = *blk;
+
+	uint4set_builder_flush(b);
+
+	copy.offset = b->data.len;
+	appendBinaryStringInfo(&b->data,
+						   (const char *) UINT4SET_DATA(set) + blk->offset,
+						   UINT4SET_PACKED_LEN(blk));
+	appendBinaryStringInfo(&b->blocks, (char *) &copy, sizeof(copy));
+	b->nvalues += blk->nvalues;
+}
+
+static Uint4Set *
+uint4set_builder_finish(Uint4SetBuilder *b)
+{
+	Uint4Set   *result;
+	Size		size;
+
+	uint4set_builder_flush(b);
+
+	size = sizeof(Uint4Set) + b->blocks.len + b->data.len;
+	result = (Uint4Set *) palloc0(size);
+	SET_VARSIZE(result, size);
+	result->nvalues = b->nvalues;
+	result->nblocks = b->blocks.len / sizeof(Uint4SetBlock);
+	memcpy((char *) result + sizeof(Uint4Set), b->blocks.data, b->blocks.len);
+	memcpy((char *) result + sizeof(Uint4Set) + b->blocks.len,
+		   b->data.data, b->data.len);
+
+	pfree(b->blocks.data);
+	pfree(b->data.data);
+
+	return result;
+}
+
+/* Build a set from n sorted, distinct values */
+static Uint4Set *
+uint4set_from_sorted(const uint32 *values, int n)
+{
+	Uint4SetBuilder b;
+	int			i;
+
+	uint4set_builder_init(&b);
+	for (i = 0; i < n; i++)
+		uint4set_builder_add(&b, values[i]);
+
+	return uint4set_builder_finish(&b);
+}
+
+/*
+ * Position in a set.  The current block is only unpacked when a value other
+ * than its first is needed.
+ */
+typedef struct
+{
+	const Uint4Set *set;
+	const Uint4SetBlock *blk;	/* current block */
+	const Uint4SetBlock *end;
+	bool		unpacked;
+	int			pos;
+	int			n;
+	uint32		values[UINT4SET_BLOCK_SIZE];
+} Uint4SetCursor;
+
+static void
+uint4set_cursor_init(Uint4SetCursor *c, const Uint4Set *set)
+{
+	c->set = set;
+	c->blk = UINT4SET_BLOCKS(set);
+	c->end = c->blk + set->nblocks;
+	c->unpacked = false;
+}
+
+static inline bool
+uint4set_cursor_done(const Uint4SetCursor *c)
+{
+	return c->blk >= c->end;
+}
+
+static inline uint32
+uint4set_cursor_value(const Uint4SetCursor *c)
+{
+	return c->unpacked ? c->values[c->pos] : c->blk->first;
+}
+
+static inline void
+uint4set_cursor_unpack(Uint4SetCursor *c)
+{
+	if (!c->unpacked)
+	{
+		c->n = uint4set_unpack(c->set, c->blk, c->values);
+		c->pos = 0;
+		c->unpacked = true;
+	}
+}
+
+static inline void
+uint4set_cursor_next_block(Uint4SetCursor *c)
+{
+	c->blk++;
+	c->unpacked = false;
+}
+
+static inline void
+uint4set_cursor_next(Uint4SetCursor *c)
+{
+	Assert(c->unpacked);
+	if (++c->pos >= c->n)
+		uint4set_cursor_next_block(c);
+}
+
+DECLARE(uint4set_in)
+Datum
+uint4set_in(PG_FUNCTION_ARGS)
+{
+	uint32	   *values;
+	int			n;
+
+	values = uint4_list_in(PG_GETARG_CSTRING(0), "uint4set", &n);
+	PG_RETURN_POINTER(uint4set_from_sorted(values, n));
+}
+
+DECLARE(uint4set_out)
+Datum
+uint4set_out(PG_FUNCTION_ARGS)
+{
+	Uint4Set   *set = PG_GETARG_UINT4SET_P(0);
+	const Uint4SetBlock *blk = UINT4SET_BLOCKS(set);
+	uint32		values[UINT4SET_BLOCK_SIZE];
+	StringInfoData buf;
+	uint32		b;
+
+	initStringInfo(&buf);
+	appendStringInfoChar(&buf, '{');
+	for (b = 0; b < set->nblocks; b++)
+	{
+		int			n = uint4set_unpack(set, &blk[b], values);
+		int			i;
+
+		enlargeStringInfo(&buf, n * (MAXUINT4LEN + 1));
+		for (i = 0; i < n; i++)
+		{
+			if (buf.len > 1)
+				buf.data[buf.len++] = ',';
+			buf.len += pg_u4toa(values[i], buf.data + buf.len);
+		}
+	}
+	appendStringInfoChar(&buf, '}');
+
+	PG_RETURN_CSTRING(buf.data);
+}
+
+DECLARE(uint4set_from_array)
+Datum
+uint4set_from_array(PG_FUNCTION_ARGS)
+{
+	ArrayType  *a = PG_GETARG_ARRAYTYPE_P(0);
+	uint32	   *values;
+	int			n;
+
+	if (ARR_NDIM(a) > 1)
+		ereport(ERROR,
+				(errcode(ERRCODE_ARRAY_SUBSCRIPT_ERROR),
+				 errmsg("array must be one-dimensional")));
+	if (array_contains_nulls(a))
+		ereport(ERROR,
+				(errcode(ERRCODE_NULL_VALUE_NOT_ALLOWED),
+				 errmsg("array must not contain nulls")));
+
+	n = ArrayGetNItems(ARR_NDIM(a), ARR_DIMS(a));
+	values = (uint32 *) palloc(sizeof(uint32) * Max(n, 1));
+	memcpy(values, ARR_DATA_PTR(a), sizeof(uint32) * n);
+	n = uint32_sort_unique(values, n);
+
+	PG_RETURN_POINTER(uint4set_from_sorted(values, n));
+}
+
+DECLARE(uint4set_to_array)
+Datum
+uint4set_to_array(PG_FUNCTION_ARGS)
+{
+	Uint4Set   *set = PG_GETARG_UINT4SET_P(0);
+	const Uint4SetBlock *blk = UINT4SET_BLOCKS(set);
+	Oid			elemtype = get_element_type(get_func_rettype(fcinfo->flinfo->fn_oid));
+	uint32	   *values;
+	uint32	   *data;
+	uint32		b;
+
+	values = (uint32 *) palloc(sizeof(uint32) * Max(set->nvalues, 1));
+	data = values;
+	for (b = 0; b < set->nblocks; b++)
+		data += uint4set_unpack(set, &blk[b], data);
+
+	PG_RETURN_ARRAYTYPE_P(make_uint_array(values, set->nvalues, elemtype,
+										  sizeof(uint32)));
+}
+
+DECLARE(uint4set_count)
+Datum
+uint4set_count(PG_FUNCTION_ARGS)
+{
+	Uint4Set   *set = PG_GETARG_UINT4SET_P(0);
+
+	PG_RETURN_INT64(set->nvalues);
+}
+
+/* Find the block that could hold value, then unpack only that one */
+static bool
+uint4set_member(const Uint4Set *set, uint32 value)
+{
+	const Uint4SetBlock *blk = UINT4SET_BLOCKS(set);
+	uint32		values[UINT4SET_BLOCK_SIZE];
+	int			lo = 0;
+	int			hi = set->nblocks;
+	int			n;
+
+	/* Find the last block with first <= value */
+	while (lo < hi)
+	{
+		int			mid = lo + (hi - lo) / 2;
+
+		if (blk[mid].first <= value)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	if (lo == 0 || value > blk[lo - 1].last)
+		return false;
+	blk = &blk[lo - 1];
+	if (value == blk->first || value == blk->last)
+		return true;
+
+	n = uint4set_unpack(set, blk, values);
+	lo = 1;
+	hi = n - 1;
+	while (lo < hi)
+	{
+		int			mid = lo + (hi - lo) / 2;
+
+		if (values[mid] < value)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	return values[lo] == value;
+}
+
+DECLARE(uint4set_contains)
+Datum
+uint4set_contains(PG_FUNCTION_ARGS)
+{
+	Uint4Set   *set = PG_GETARG_UINT4SET_P(0);
+
+	PG_RETURN_BOOL(uint4set_member(set, PG_GETARG_UINT32(1)));
+}
+
+DECLARE(uint4set_contained)
+Datum
+uint4set_contained(PG_FUNCTION_ARGS)
+{
+	Uint4Set   *set = PG_GETARG_UINT4SET_P(1);
+
+	PG_RETURN_BOOL(uint4set_member(set, PG_GETARG_UINT32(0)));
+}
+
+DECLARE(uint4set_intersect)
+Datum
+uint4set_intersect(PG_FUNCTION_ARGS)
+{
+	Uint4Set   *a = PG_GETARG_UINT4SET_P(0);
+	Uint4Set   *b = PG_GETARG_UINT4SET_P(1);
+	Uint4SetCursor *ca = palloc(sizeof(Uint4SetCursor));
+	Uint4SetCursor *cb = palloc(sizeof(Uint4SetCursor));
+	Uint4SetBuilder result;
+
+	uint4set_builder_init(&result);
+	uint4set_cursor_init(ca, a);
+	uint4set_cursor_init(cb, b);
+
+	while (!uint4set_cursor_done(ca) && !uint4set_cursor_done(cb))
+	{
+		uint32		x;
+		uint32		y;
+
+		/* Skip whole blocks that end before the other side's position */
+		if (ca->blk->last < uint4set_cursor_value(cb))
+		{
+			uint4set_cursor_next_block(ca);
+			continue;
+		}
+		if (cb->blk->last < uint4set_cursor_value(ca))
+		{
+			uint4set_cursor_next_block(cb);
+			continue;
+		}
+
+		uint4set_cursor_unpack(ca);
+		uint4set_cursor_unpack(cb);
+		x = uint4set_cursor_value(ca);
+		y = uint4set_cursor_value(cb);
+		if (x == y)
+			uint4set_builder_add(&result, x);
+		if (x <= y)
+			uint4set_cursor_next(ca);
+		if (y <= x)
+			uint4set_cursor_next(cb);
+	}
+
+	PG_RETURN_POINTER(uint4set_builder_finish(&result));
+}
+
+/* Add what is left of c, copying blocks it hasn't unpacked */
+static void
+uint4set_union_rest(Uint4SetBuilder *result, Uint4SetCursor *c)
+{
+	while (!uint4set_cursor_done(c))
+	{
+		if (c->unpacked)
+		{
+			uint4set_builder_add(result, uint4set_cursor_value(c));
+			uint4set_cursor_next(c);
+		}
+		else
+		{
+			uint4set_builder_add_block(result, c->set, c->blk);
+			uint4set_cursor_next_block(c);
+		}
+	}
+}
+
+DECLARE(uint4set_union)
+Datum
+uint4set_union(PG_FUNCTION_ARGS)
+{
+	Uint4Set   *a = PG_GETARG_UINT4SET_P(0);
+	Uint4Set   *b = PG_GETARG_UINT4SET_P(1);
+	Uint4SetCursor *ca = palloc(sizeof(Uint4SetCursor));
+	Uint4SetCursor *cb = palloc(sizeof(Uint4SetCursor));
+	Uint4SetBuilder result;
+
+	uint4set_builder_init(&result);
+	uint4set_cursor_init(ca, a);
+	uint4set_cursor_init(cb, b);
+
+	while (!uint4set_cursor_done(ca) && !uint4set_cursor_done(cb))
+	{
+		uint32		x;
+		uint32		y;
+
+		/* Blocks that end before the other side's position go in packed */
+		if (!ca->unpacked && ca->blk->last < uint4set_cursor_value(cb))
+		{
+			uint4set_builder_add_block(&result, a, ca->blk);
+			uint4set_cursor_next_block(ca);
+			continue;
+		}
+		if (!cb->unpacked && cb->blk->last < uint4set_cursor_value(ca))
+		{
+			uint4set_builder_add_block(&result, b, cb->blk);
+			uint4set_cursor_next_block(cb);
+			continue;
+		}
+
+		uint4set_cursor_unpack(ca);
+		uint4set_cursor_unpack(cb);
+		x = uint4set_cursor_value(ca);
+		y = uint4set_cursor_value(cb);
+		uint4set_builder_add(&result, Min(x, y));
+		if (x <= y)
+			uint4set_cursor_next(ca);
+		if (y <= x)
+			uint4set_cursor_next(cb);
+	}
+	uint4set_union_rest(&result, ca);
+	uint4set_union_rest(&result, cb);
+
+	PG_RETURN_POINTER(uint4set_builder_finish(&result));
+}
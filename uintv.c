@@ -0,0 +1,299 @@
+/*-------------------------------------------------------------------------
+ *
+ * uintv.c
+ *	  Variable-length unsigned integer type
+ *
+ *	  uintv holds the same values as uint8, in one to nine bytes on disk
+ *	  instead of eight, see uintv.h for the encoding.  The comparisons work
+ *	  on the encoded form; only I/O, the casts and the hashes decode it.
+ *	  The hashes match uint8_hash, so equal uintv and uint8 values hash the
+ *	  same.
+ *
+ * Portions Copyright (c) 1996-2013, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include <limits.h>
+
+#include "access/hash.h"
+#include "port/pg_bitutils.h"
+#include "utils/builtins.h"
+#include "utils/sortsupport.h"
+
+#include "declare.h"
+#include "uintv.h"
+#include "uints_numutils.h"
+#include "uints_fmgr.h"
+#include "uints_pqformat.h"
+
+/* Encode value with the fewest bytes */
+static struct varlena *
+uintv_encode(uint64 value)
+{
+	int			nbytes = (value == 0) ? 0 : pg_leftmost_one_pos64(value) / 8 + 1;
+	struct varlena *result = (struct varlena *) palloc(VARHDRSZ + nbytes);
+	uint8	   *data = (uint8 *) VARDATA(result);
+	int			i;
+
+	SET_VARSIZE(result, VARHDRSZ + nbytes);
+	for (i = nbytes - 1; i >= 0; i--)
+	{
+		data[i] = (uint8) value;
+		value >>= 8;
+	}
+
+	return result;
+}
+
+uint64
+uintv_decode(const struct varlena *v)
+{
+	const uint8 *data = (const uint8 *) VARDATA_ANY(v);
+	int			nbytes = VARSIZE_ANY_EXHDR(v);
+	uint64		result = 0;
+	int			i;
+
+	for (i = 0; i < nbytes; i++)
+		result = (result << 8) | data[i];
+
+	return result;
+}
+
+/* Compare encoded values: by length, and bytewise for equal lengths */
+static inline int
+uintv_cmp_internal(const struct varlena *a, const struct varlena *b)
+{
+	int			alen = VARSIZE_ANY_EXHDR(a);
+	int			blen = VARSIZE_ANY_EXHDR(b);
+	int			cmp;
+
+	if (alen != blen)
+		return (alen > blen) ? 1 : -1;
+
+	cmp = memcmp(VARDATA_ANY(a), VARDATA_ANY(b), alen);
+	return (cmp > 0) - (cmp < 0);
+}
+
+/*****************************************************************************
+ *	 USER I/O ROUTINES														 *
+ *****************************************************************************/
+
+/*
+ *		uintvin			- converts "num" to uintv
+ */
+DECLARE(uintvin)
+Datum
+uintvin(PG_FUNCTION_ARGS)
+{
+	char	   *num = PG_GETARG_CSTRING(0);
+
+	PG_RETURN_POINTER(uintv_encode(pg_atouv(num, '\0')));
+}
+
+/*
+ *		uintvout			- converts uintv to "num"
+ */
+DECLARE(uintvout)
+Datum
+uintvout(PG_FUNCTION_ARGS)
+{
+	uint64		val = uintv_decode(PG_GETARG_UINTV_PP(0));
+	char	   *result = (char *) palloc(MAXUINT8LEN + 1);
+
+	pg_u8toa(val, result);
+	PG_RETURN_CSTRING(result);
+}
+
+/*
+ *		uintvrecv			- converts external binary format to uintv
+ *
+ * The binary format is that of uint8, so that clients need not know about
+ * the encoding.
+ */
+DECLARE(uintvrecv)
+Datum
+uintvrecv(PG_FUNCTION_ARGS)
+{
+	StringInfo	buf = (StringInfo) PG_GETARG_POINTER(0);
+
+	PG_RETURN_POINTER(uintv_encode(uint_getmsg64(buf)));
+}
+
+/*
+ *		uintvsend			- converts uintv to binary format
+ */
+DECLARE(uintvsend)
+Datum
+uintvsend(PG_FUNCTION_ARGS)
+{
+	uint64		n = pg_hton64(uintv_decode(PG_GETARG_UINTV_PP(0)));
+
+	PG_RETURN_BYTEA_P(uint_sendbytes(&n, sizeof(n)));
+}
+
+/*
+ *		===================
+ *		CONVERSION ROUTINES
+ *		===================
+ */
+
+DECLARE(uvtou8)
+Datum
+uvtou8(PG_FUNCTION_ARGS)
+{
+	PG_RETURN_UINT64(uintv_decode(PG_GETARG_UINTV_PP(0)));
+}
+
+DECLARE(u8touv)
+Datum
+u8touv(PG_FUNCTION_ARGS)
+{
+	PG_RETURN_POINTER(uintv_encode(PG_GETARG_UINT64(0)));
+}
+
+DECLARE(uvtou4)
+Datum
+uvtou4(PG_FUNCTION_ARGS)
+{
+	uint64		arg = uintv_decode(PG_GETARG_UINTV_PP(0));
+
+	if (arg > UINT_MAX)
+		ereport(ERROR,
+				(errcode(ERRCODE_NUMERIC_VALUE_OUT_OF_RANGE),
+				 errmsg("uint4 out of range")));
+
+	PG_RETURN_UINT32((uint32) arg);
+}
+
+DECLARE(u4touv)
+Datum
+u4touv(PG_FUNCTION_ARGS)
+{
+	PG_RETURN_POINTER(uintv_encode(PG_GETARG_UINT32(0)));
+}
+
+/*
+ *		==================
+ *		COMPARISON ROUTINES
+ *		==================
+ */
+
+#define UINTV_CMP()	uintv_cmp_internal(PG_GETARG_UINTV_PP(0), PG_GETARG_UINTV_PP(1))
+
+DECLARE(uintveq)
+Datum
+uintveq(PG_FUNCTION_ARGS)
+{
+	PG_RETURN_BOOL(UINTV_CMP() == 0);
+}
+
+DECLARE(uintvne)
+Datum
+uintvne(PG_FUNCTION_ARGS)
+{
+	PG_RETURN_BOOL(UINTV_CMP() != 0);
+}
+
+DECLARE(uintvlt)
+Datum
+uintvlt(PG_FUNCTION_ARGS)
+{
+	PG_RETURN_BOOL(UINTV_CMP() < 0);
+}
+
+DECLARE(uintvle)
+Datum
+uintvle(PG_FUNCTION_ARGS)
+{
+	PG_RETURN_BOOL(UINTV_CMP() <= 0);
+}
+
+DECLARE(uintvgt)
+Datum
+uintvgt(PG_FUNCTION_ARGS)
+{
+	PG_RETURN_BOOL(UINTV_CMP() > 0);
+}
+
+DECLARE(uintvge)
+Datum
+uintvge(PG_FUNCTION_ARGS)
+{
+	PG_RETURN_BOOL(UINTV_CMP() >= 0);
+}
+
+/* Comparators */
+
+DECLARE(uintv_cmp)
+Datum
+uintv_cmp(PG_FUNCTION_ARGS)
+{
+	PG_RETURN_INT32(UINTV_CMP());
+}
+
+DECLARE(uintvlarger)
+Datum
+uintvlarger(PG_FUNCTION_ARGS)
+{
+	struct varlena *arg1 = PG_GETARG_UINTV_PP(0);
+	struct varlena *arg2 = PG_GETARG_UINTV_PP(1);
+
+	PG_RETURN_POINTER((uintv_cmp_internal(arg1, arg2) > 0) ? arg1 : arg2);
+}
+
+DECLARE(uintvsmaller)
+Datum
+uintvsmaller(PG_FUNCTION_ARGS)
+{
+	struct varlena *arg1 = PG_GETARG_UINTV_PP(0);
+	struct varlena *arg2 = PG_GETARG_UINTV_PP(1);
+
+	PG_RETURN_POINTER((uintv_cmp_internal(arg1, arg2) < 0) ? arg1 : arg2);
+}
+
+/* Sort support: a plain C comparator, avoiding the fmgr call */
+static int
+uintv_fastcmp(Datum x, Datum y, SortSupport ssup)
+{
+	return uintv_cmp_internal(DatumGetUintVP(x), DatumGetUintVP(y));
+}
+
+DECLARE(uintv_sortsupport)
+Datum
+uintv_sortsupport(PG_FUNCTION_ARGS)
+{
+	SortSupport ssup = (SortSupport) PG_GETARG_POINTER(0);
+
+	ssup->comparator = uintv_fastcmp;
+	PG_RETURN_VOID();
+}
+
+/* Hashes */
+
+/* Fold the value to 32 bits the way uint8_hash does */
+static inline uint32
+uintv_hash_fold(const struct varlena *v)
+{
+	uint64		val = uintv_decode(v);
+
+	return (uint32) val ^ (uint32) (val >> 32);
+}
+
+DECLARE(uintv_hash)
+Datum
+uintv_hash(PG_FUNCTION_ARGS)
+{
+	PG_RETURN_UINT32(hash_uint32(uintv_hash_fold(PG_GETARG_UINTV_PP(0))));
+}
+
+DECLARE(uintv_hash_extended)
+Datum
+uintv_hash_extended(PG_FUNCTION_ARGS)
+{
+	return hash_uint32_extended(uintv_hash_fold(PG_GETARG_UINTV_PP(0)),
+								PG_GETARG_INT64(1));
+}
@@ -0,0 +1,31 @@
+/*-------------------------------------------------------------------------
+ *
+ * uintv.h
+ *	  Declarations for the variable-length unsigned integer type
+ *
+ *	  A uintv is a varlena whose payload is the value in big-endian order
+ *	  with no leading zero bytes, so zero has an empty payload and no value
+ *	  takes more than eight bytes.  Stored in a tuple it gets a one-byte
+ *	  header.  Since the encoding is minimal, a longer payload always means
+ *	  a larger value, and payloads of equal length compare as bytes.
+ *
+ * Portions Copyright (c) 1996-2013, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ *
+ *-------------------------------------------------------------------------
+ */
+#ifndef UINTV_H
+#define UINTV_H
+
+/*
+ * A uintv never exceeds the inline size limits, so it is never compressed or
+ * moved out of line, and fetching it never copies.  A short header is left
+ * as it is; read the value with the _ANY macros.
+ */
+#define DatumGetUintVP(X)		((struct varlena *) PG_DETOAST_DATUM_PACKED(X))
+#define PG_GETARG_UINTV_PP(n)	DatumGetUintVP(PG_GETARG_DATUM(n))
+
+extern uint64 uintv_decode(const struct varlena *v);
+
+#endif							/* UINTV_H */